@@ -25,6 +25,10 @@ DEFINES += DEBUG_LASSO_FEEDBACK=0
 DEFINES += DEBUG_OUTPUT=0
 DEFINES += OLD_ISF=0
 
+# Strokes, their DrawingAttributes and StylusPoints without QObject: they
+#  notify observers instead of raising signals, see InkCanvas_global.h
+inkcanvas_light_strokes: DEFINES += INKCANVAS_LIGHT_STROKES=1
+
 SOURCES += \
     cmath.cpp \
     double.cpp \
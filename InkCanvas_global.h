@@ -30,6 +30,14 @@
 #  define INKCANVAS_QT_DRAW
 #endif
 
+// Stroke, DrawingAttributes and StylusPointCollection are QObjects raising
+//  signals, unless built with INKCANVAS_LIGHT_STROKES; then they notify
+//  observers (Internal/Ink/changeobservers.h) and the signals are raised by
+//  adapters created on demand (Windows/Ink/inksignals.h)
+#if defined INKCANVAS_QT_SIGNALS && !defined INKCANVAS_LIGHT_STROKES
+#  define INKCANVAS_INK_SIGNALS
+#endif
+
 #ifdef INKCANVAS_QT
 #  include <QtCore/qglobal.h>
 #else
@@ -144,6 +144,21 @@ void InkCanvasFeedbackAdorner::OnRender(DrawingContext& drawingContext)
     // No need to invoke VerifyAccess since this method calls DrawingContext.DrawRectangle.
 
     Debug::Assert(_frameSize != Size(0, 0));
+
+    // Draw the snapshot of the selection, one blit however many strokes it holds.
+    if ( !_proxyImage.isNull() )
+    {
+        // The frame holds the feedback rectangle, the image is stretched along
+        //  with it, including the part reaching past it
+        double offset = BorderMargin + CornerResizeHandleSize / 2;
+        double scaleX = std::max(_frameSize.Width() - 2 * offset, 0.0) / _proxySourceBounds.Width();
+        double scaleY = std::max(_frameSize.Height() - 2 * offset, 0.0) / _proxySourceBounds.Height();
+        drawingContext.DrawImage(_proxyImage,
+            Rect(offset + (_proxyImageBounds.Left() - _proxySourceBounds.Left()) * scaleX,
+                 offset + (_proxyImageBounds.Top() - _proxySourceBounds.Top()) * scaleY,
+                 _proxyImageBounds.Width() * scaleX, _proxyImageBounds.Height() * scaleY));
+    }
+
     // Draw the wire frame.
     drawingContext.DrawRectangle(QBrush(), _adornerBorderPen,
         Rect(CornerResizeHandleSize / 2, CornerResizeHandleSize / 2,
@@ -160,4 +175,20 @@ void InkCanvasFeedbackAdorner::UpdateBounds(Rect const &rect)
     OnBoundsUpdated(rect);
 }
 
+/// <summary>
+/// The method is called by InkCanvasSelection.StartFeedbackAdorner and EndFeedbackAdorner
+/// </summary>
+/// <param name="image"></param>
+/// <param name="imageBounds"></param>
+/// <param name="sourceBounds"></param>
+void InkCanvasFeedbackAdorner::SetProxyImage(QImage const & image, Rect const & imageBounds, Rect const & sourceBounds)
+{
+    VerifyAccess();
+
+    _proxyImage = image;
+    _proxyImageBounds = imageBounds;
+    _proxySourceBounds = sourceBounds;
+    InvalidateVisual();
+}
+
 INKCANVAS_END_NAMESPACE
@@ -4,6 +4,7 @@
 #include "Windows/Controls/decorator.h"
 
 #include <QPen>
+#include <QImage>
 
 // namespace MS.Internal.Controls
 INKCANVAS_BEGIN_NAMESPACE
@@ -60,6 +61,16 @@ public:
     /// <param name="rect"></param>
     void UpdateBounds(Rect const &rect);
 
+    /// <summary>
+    /// Sets the image drawn stretched with the feedback rectangle, a snapshot
+    /// of the selected strokes taken when the editing started. A null image
+    /// draws the wire frame only.
+    /// </summary>
+    /// <param name="image"></param>
+    /// <param name="imageBounds">The area the image covers, may reach past sourceBounds</param>
+    /// <param name="sourceBounds">The feedback rectangle when the image was taken</param>
+    void SetProxyImage(QImage const & image, Rect const & imageBounds, Rect const & sourceBounds);
+
 private:
     InkCanvas&   _inkCanvas;
     Size        _frameSize;
@@ -68,6 +79,9 @@ private:
     double      _offsetY = 0;
 
     QPen         _adornerBorderPen;
+    QImage       _proxyImage;
+    Rect         _proxyImageBounds;
+    Rect         _proxySourceBounds;
 
     static constexpr int       CornerResizeHandleSize = 8;
     static constexpr double    BorderMargin = 8;
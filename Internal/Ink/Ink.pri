@@ -3,17 +3,25 @@
 
 HEADERS += \
     $$PWD/bezier.h \
+    $$PWD/changeobservers.h \
     $$PWD/contoursegment.h \
     $$PWD/cuspdata.h \
     $$PWD/ellipticalnodeoperations.h \
+    $$PWD/geometrycachemanager.h \
+    $$PWD/incrementalbezier.h \
+    $$PWD/inputpredictor.h \
     $$PWD/erasingstroke.h \
     $$PWD/quad.h \
     $$PWD/lasso.h \
     $$PWD/strokefindices.h \
+    $$PWD/strokegeometrycache.h \
     $$PWD/strokenode.h \
+    $$PWD/strokenodebatch.h \
+    $$PWD/strokenodebatchkernels.h \
     $$PWD/strokenodedata.h \
     $$PWD/strokenodeiterator.h \
     $$PWD/strokenodeoperations.h \
+    $$PWD/strokerasterizer.h \
     $$PWD/strokerenderer.h \
 
 SOURCES += \
@@ -21,16 +29,32 @@ SOURCES += \
     $$PWD/contoursegment.cpp \
     $$PWD/cuspdata.cpp \
     $$PWD/ellipticalnodeoperations.cpp \
+    $$PWD/geometrycachemanager.cpp \
+    $$PWD/incrementalbezier.cpp \
+    $$PWD/inputpredictor.cpp \
     $$PWD/erasingstroke.cpp \
     $$PWD/quad.cpp \
     $$PWD/lasso.cpp \
     $$PWD/strokefindices.cpp \
+    $$PWD/strokegeometrycache.cpp \
     $$PWD/strokenode.cpp \
+    $$PWD/strokenodebatch.cpp \
     $$PWD/strokenodedata.cpp \
     $$PWD/strokenodeiterator.cpp \
     $$PWD/strokenodeoperations.cpp \
+    $$PWD/strokerasterizer.cpp \
     $$PWD/strokerenderer.cpp \
 
+# AVX kernels of StrokeNodeBatch, compiled with AVX code generation and
+#  selected at runtime when the processor supports them. simd.prf builds
+#  AVX_SOURCES only if the compiler supports AVX (CONFIG avx, as for
+#  QT_COMPILER_SUPPORTS_AVX), the dispatch is enabled under the same test
+contains(QT_ARCH, x86_64)|contains(QT_ARCH, i386): {
+    CONFIG += simd
+    AVX_SOURCES += $$PWD/strokenodebatch_avx.cpp
+    CONFIG(avx): DEFINES += INKCANVAS_NODEBATCH_AVX=1
+}
+
 inkcanvas_core: {
 
 HEADERS += \
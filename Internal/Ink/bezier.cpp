@@ -191,16 +191,40 @@ bool Bezier::ConstructFromData(CuspData & data, double fitError)
     // get (error)^2
     fitError *= (fitError);
 
+    FitState state;
+    return FitSegments(data, fitError, state);
+}
+
+
+/// <summary>
+/// Fits the segments of ConstructFromData from state on
+/// </summary>
+/// <param name="data">In: Data points, with tangent links set</param>
+/// <param name="fitError">In: tolerated error - squared</param>
+/// <param name="state">In: Where to start, updated to where it stopped</param>
+/// <param name="settled">Out: updated to the state after the last segment
+/// that points appended to data can't change, if not null</param>
+/// <param name="settledPointCount">Out: the bezier point count at settled</param>
+/// <returns>Whether bezier construction is possible</returns>
+bool Bezier::FitSegments(CuspData & data, double fitError, FitState & state,
+                         FitState * settled, int * settledPointCount)
+{
     bool done = false;
     int to = 0;
-    int next_cusp = 0;
-    int prev_cusp = 0;
-    bool is_a_cusp = true;
-    Vector tanEnd(0, 0);
+    int & next_cusp = state.nextCusp;
+    int & prev_cusp = state.prevCusp;
+    bool & is_a_cusp = state.isCusp;
+    Vector & tanEnd = state.tanEnd;
     Vector tanStart(0, 0);
 
-    for (int from = 0; !done; from = to)
+    // A segment is settled when it ends before the last settled cusp and
+    // all tangent links it reads are settled
+    int settledCusp = data.SettledCusp();
+    int tanLinked = data.TanLinkedCount();
+
+    for (int & from = state.from; !done; from = to)
     {
+        bool startsAtCusp = is_a_cusp;
         if (is_a_cusp)
         {
             prev_cusp = next_cusp;
@@ -231,6 +255,18 @@ bool Bezier::ConstructFromData(CuspData & data, double fitError)
         {
             return false;
         }
+
+        if (settled != nullptr && !done && next_cusp <= settledCusp && to < tanLinked
+                && (!startsAtCusp || data.TanNext(from) < tanLinked))
+        {
+            *settled = state;
+            settled->from = to;
+            *settledPointCount = BezierPointCount();
+        }
+        else
+        {
+            settled = nullptr;
+        }
     }
 
     return true;
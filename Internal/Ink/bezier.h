@@ -14,6 +14,18 @@ class CuspData;
 class Bezier
 {
 public:
+    /// <summary>
+    /// Position of the segment loop of ConstructFromData between two segments
+    /// </summary>
+    struct FitState
+    {
+        int from = 0;
+        int nextCusp = 0;
+        int prevCusp = 0;
+        bool isCusp = true;
+        Vector tanEnd;
+    };
+
     Bezier();
 
 
@@ -66,6 +78,19 @@ public:
     /// <returns>Whether bezier construction is possible</returns>
     bool ConstructFromData(CuspData & data, double fitError);
 
+    /// <summary>
+    /// Fits the segments of ConstructFromData from state on
+    /// </summary>
+    /// <param name="data">In: Data points, with tangent links set</param>
+    /// <param name="fitError">In: tolerated error - squared</param>
+    /// <param name="state">In: Where to start, updated to where it stopped</param>
+    /// <param name="settled">Out: updated to the state after the last segment
+    /// that points appended to data can't change, if not null</param>
+    /// <param name="settledPointCount">Out: the bezier point count at settled</param>
+    /// <returns>Whether bezier construction is possible</returns>
+    bool FitSegments(CuspData & data, double fitError, FitState & state,
+                     FitState * settled = nullptr, int * settledPointCount = nullptr);
+
 
     /// <summary>
     /// Add parabola to the bezier
@@ -147,6 +172,14 @@ public:
     }
 
 
+    /// <summary>
+    /// Removes the bezier control points from index start on
+    /// </summary>
+    void RemoveBezierPoints(int start)
+    {
+        _bezierControlPoints.RemoveRange(start, _bezierControlPoints.Count() - start);
+    }
+
     /// <summary>
     /// Count of bezier control points
     /// </summary>
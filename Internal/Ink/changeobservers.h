@@ -0,0 +1,207 @@
+#ifndef CHANGEOBSERVERS_H
+#define CHANGEOBSERVERS_H
+
+#include "InkCanvas_global.h"
+#include "Collections/Generic/list.h"
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+class Stroke;
+class DrawingAttributes;
+class StylusPointCollection;
+class EventArgs;
+class CancelEventArgs;
+class PropertyDataChangedEventArgs;
+class DrawingAttributesReplacedEventArgs;
+class StylusPointsReplacedEventArgs;
+
+/// <summary>
+/// The observers of a stroke, its drawing attributes or stylus points, when
+/// those are not QObjects (see INKCANVAS_INK_SIGNALS). Takes two pointers:
+/// the first observer, nearly always the only one, is held in place, more
+/// go to a list allocated for them. Copies of the notifier start without
+/// observers, as a copied QObject starts without connections.
+/// </summary>
+template <typename Observer>
+class ObserverList
+{
+public:
+    ObserverList() {}
+    ObserverList(ObserverList const &) {}
+    ObserverList & operator=(ObserverList const &) { return *this; }
+    ~ObserverList() { delete more_; }
+
+    bool IsEmpty() const
+    {
+        return first_ == nullptr;
+    }
+
+    void Add(Observer * observer)
+    {
+        if (first_ == nullptr)
+        {
+            first_ = observer;
+            return;
+        }
+        if (more_ == nullptr)
+            more_ = new List<Observer *>;
+        more_->Add(observer);
+    }
+
+    void Remove(Observer * observer)
+    {
+        if (first_ == observer)
+        {
+            if (more_ == nullptr || more_->Count() == 0)
+            {
+                first_ = nullptr;
+                return;
+            }
+            first_ = (*more_)[0];
+            more_->RemoveAt(0);
+        }
+        else if (more_ != nullptr)
+        {
+            more_->Remove(observer);
+        }
+    }
+
+    bool Contains(Observer * observer) const
+    {
+        return first_ == observer
+                || (observer != nullptr && more_ != nullptr && more_->Contains(observer));
+    }
+
+    /// <summary>
+    /// Calls notify on each observer. Observers may add or remove observers
+    /// meanwhile; those removed before their turn are skipped.
+    /// </summary>
+    template <typename Func>
+    void Notify(Func notify) const
+    {
+        if (first_ == nullptr)
+            return;
+        if (more_ == nullptr || more_->Count() == 0)
+        {
+            notify(*first_);
+            return;
+        }
+        List<Observer *> observers;
+        observers.reserve(more_->Count() + 1);
+        observers.Add(first_);
+        observers.AddRange(*more_);
+        for (int i = 0; i < observers.Count(); ++i)
+        {
+            if (i == 0 || Contains(observers[i]))
+                notify(*observers[i]);
+        }
+    }
+
+private:
+    Observer * first_ = nullptr;
+    List<Observer *> * more_ = nullptr;
+};
+
+/// <summary>
+/// Observes a StylusPointCollection, in place of its Changed and
+/// CountGoingToZero signals
+/// </summary>
+class StylusPointCollectionObserver
+{
+public:
+    virtual void StylusPoints_Changed(StylusPointCollection & stylusPoints) = 0;
+
+    /// <summary>
+    /// Cancelling e keeps the collection from being emptied
+    /// </summary>
+    virtual void StylusPoints_CountGoingToZero(StylusPointCollection & stylusPoints, CancelEventArgs & e)
+    {
+        (void) stylusPoints;
+        (void) e;
+    }
+
+protected:
+    ~StylusPointCollectionObserver() {}
+};
+
+/// <summary>
+/// Observes a DrawingAttributes, in place of its AttributeChanged and
+/// PropertyDataChanged signals
+/// </summary>
+class DrawingAttributesObserver
+{
+public:
+    virtual void DrawingAttributes_AttributeChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & e) = 0;
+
+    virtual void DrawingAttributes_PropertyDataChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & e)
+    {
+        (void) drawingAttributes;
+        (void) e;
+    }
+
+protected:
+    ~DrawingAttributesObserver() {}
+};
+
+/// <summary>
+/// Observes a Stroke, in place of its signals. Renderers and collections
+/// observe all their strokes through one of these, instead of a connection
+/// per stroke and signal.
+/// </summary>
+class StrokeObserver
+{
+public:
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & e)
+    {
+        (void) stroke;
+        (void) e;
+    }
+
+    virtual void Stroke_DrawingAttributesChanged(Stroke & stroke, PropertyDataChangedEventArgs & e)
+    {
+        (void) stroke;
+        (void) e;
+    }
+
+    virtual void Stroke_DrawingAttributesReplaced(Stroke & stroke, DrawingAttributesReplacedEventArgs & e)
+    {
+        (void) stroke;
+        (void) e;
+    }
+
+    virtual void Stroke_StylusPointsReplaced(Stroke & stroke, StylusPointsReplacedEventArgs & e)
+    {
+        (void) stroke;
+        (void) e;
+    }
+
+    virtual void Stroke_StylusPointsChanged(Stroke & stroke)
+    {
+        (void) stroke;
+    }
+
+    virtual void Stroke_PropertyDataChanged(Stroke & stroke, PropertyDataChangedEventArgs & e)
+    {
+        (void) stroke;
+        (void) e;
+    }
+
+    virtual void Stroke_PropertyChanged(Stroke & stroke, char const * propName)
+    {
+        (void) stroke;
+        (void) propName;
+    }
+
+    virtual void Stroke_GeometryEvicted(Stroke & stroke)
+    {
+        (void) stroke;
+    }
+
+protected:
+    ~StrokeObserver() {}
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // CHANGEOBSERVERS_H
@@ -4,12 +4,16 @@
 #include "Internal/doubleutil.h"
 #include "Windows/point.h"
 
+#include <vector>
+
 // namespace MS.Internal.Ink
 INKCANVAS_BEGIN_NAMESPACE
 
 class ContourSegment
 {
 public:
+    ContourSegment() = default;
+
     /// <summary>
     /// Constructor for linear segments
     /// </summary>
@@ -57,6 +61,72 @@ private:
     Vector  _radius;
 };
 
+/// <summary>
+/// The edges of a hitting contour. Contours of rectangle and ellipse tips fit in
+/// the inline storage, so building one on the stack for every node doesn't touch
+/// the heap. Contours of polygonal tips with many vertices spill into a vector
+/// that keeps its capacity across Clear(), so a buffer reused for the whole
+/// node iteration allocates at most once.
+/// </summary>
+class ContourSegmentBuffer
+{
+public:
+    static constexpr int InlineCapacity = 8;
+
+    ContourSegmentBuffer() = default;
+
+    ContourSegmentBuffer(ContourSegmentBuffer const & o)
+    {
+        for (ContourSegment const & s : o)
+            Add(s);
+    }
+
+    ContourSegmentBuffer & operator=(ContourSegmentBuffer const & o)
+    {
+        if (this != &o)
+        {
+            Clear();
+            for (ContourSegment const & s : o)
+                Add(s);
+        }
+        return *this;
+    }
+
+    int Count() const { return _count; }
+
+    void Clear()
+    {
+        _count = 0;
+        _overflow.clear();
+    }
+
+    void Add(ContourSegment const & segment)
+    {
+        if (_count < InlineCapacity)
+        {
+            _inline[_count] = segment;
+        }
+        else
+        {
+            if (_count == InlineCapacity)
+                _overflow.assign(_inline, _inline + InlineCapacity);
+            _overflow.push_back(segment);
+        }
+        ++_count;
+    }
+
+    ContourSegment const & operator[](int index) const { return begin()[index]; }
+
+    ContourSegment const * begin() const { return _count > InlineCapacity ? _overflow.data() : _inline; }
+
+    ContourSegment const * end() const { return begin() + _count; }
+
+private:
+    ContourSegment _inline[InlineCapacity];
+    std::vector<ContourSegment> _overflow;
+    int _count = 0;
+};
+
 INKCANVAS_END_NAMESPACE
 
 #endif // CONTOURSEGMENT_H
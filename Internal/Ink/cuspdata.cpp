@@ -4,6 +4,11 @@
 #include "Internal/doubleutil.h"
 #include "Internal/debug.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INKCANVAS_CUSPDATA_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #ifndef INKCANVAS_CORE
 #include "Internal/Ink/InkSerializedFormat/strokecollectionserializer.h"
 #else
@@ -38,40 +43,90 @@ void CuspData::Analyze(StylusPointCollection & stylusPoints, double rSpan)
     _points.reserve(stylusPoints.Count());
     _nodes.reserve(stylusPoints.Count());
 
-    // Construct the lists of data points and nodes
-    _nodes.Add(0);
-    CDataPoint cdp0;
-    cdp0.Index = 0;
-    //convert from Avalon to Himetric
-    Point point = stylusPoints[0];
-    point = Vector(point) * StrokeCollectionSerializer::AvalonToHimetricMultiplier;
-    cdp0.Point = point;
-    _points.Add(cdp0);
+    AddPoints(stylusPoints, 0);
+
+    SetLinks(rSpan);
+}
+
+/// <summary>
+/// Appends points [start, Count) of stylusPoints, the points of a stroke
+/// being collected, dropping duplicates the way Analyze does
+/// </summary>
+/// <param name="stylusPoints">Points of the stroke</param>
+/// <param name="start">First point not added yet</param>
+void CuspData::AddPoints(StylusPointCollection const & stylusPoints, int start)
+{
+    if (start >= stylusPoints.Count())
+        return;
+
+    int i = start;
+    if (Count() == 0)
+    {
+        // Construct the lists of data points and nodes
+        _nodes.Add(0);
+        CDataPoint cdp0;
+        cdp0.Index = 0;
+        //convert from Avalon to Himetric
+        _lastPoint = stylusPoints[start];
+        Point point = _lastPoint;
+        point = Vector(point) * StrokeCollectionSerializer::AvalonToHimetricMultiplier;
+        cdp0.Point = point;
+        _points.Add(cdp0);
+        _left = _right = point.X();
+        _top = _bottom = point.Y();
+        i = start + 1;
+    }
 
     //drop duplicates
-    int index = 0;
-    for (int i = 1; i < stylusPoints.Count(); i++)
+    int first = Count();
+    for (; i < stylusPoints.Count(); i++)
     {
-        if (!DoubleUtil::AreClose(stylusPoints[i].X(), stylusPoints[i - 1].X()) ||
-            !DoubleUtil::AreClose(stylusPoints[i].Y(), stylusPoints[i - 1].Y()))
+        Point stylusPoint = stylusPoints[i];
+        if (!DoubleUtil::AreClose(stylusPoint.X(), _lastPoint.X()) ||
+            !DoubleUtil::AreClose(stylusPoint.Y(), _lastPoint.Y()))
         {
             //this is a unique point, add it
-            index++;
-
             CDataPoint cdp;
-            cdp.Index = index;
+            cdp.Index = Count();
 
             //convert from Avalon to Himetric
-            Point point2 = stylusPoints[i];
+            Point point2 = stylusPoint;
             point2 = Vector(point2) * StrokeCollectionSerializer::AvalonToHimetricMultiplier;
             cdp.Point = point2;
 
-            _points.Insert(index, cdp);
-            _nodes.Insert(index, _nodes[index - 1] + (XY(index) - XY(index - 1)).Length());
+            _points.Add(cdp);
+            UpdateMinMax(point2.X(), _left, _right);
+            UpdateMinMax(point2.Y(), _top, _bottom);
         }
+        _lastPoint = stylusPoint;
     }
 
-    SetLinks(rSpan);
+    // Lengths of the new segments, independent of each other
+    int count = Count();
+    for (int n = first; n < count; ++n)
+        _nodes.Add(0);
+    int k = first;
+#if INKCANVAS_CUSPDATA_SSE2
+    for (; k + 2 <= count; k += 2)
+    {
+        __m128d dx = _mm_sub_pd(_mm_set_pd(_points[k + 1].Point.X(), _points[k].Point.X()),
+                                _mm_set_pd(_points[k].Point.X(), _points[k - 1].Point.X()));
+        __m128d dy = _mm_sub_pd(_mm_set_pd(_points[k + 1].Point.Y(), _points[k].Point.Y()),
+                                _mm_set_pd(_points[k].Point.Y(), _points[k - 1].Point.Y()));
+        double length[2];
+        _mm_storeu_pd(length, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy))));
+        _nodes[k] = length[0];
+        _nodes[k + 1] = length[1];
+    }
+#endif
+    for (; k < count; ++k)
+        _nodes[k] = (XY(k) - XY(k - 1)).Length();
+
+    // Chord lengths from the start, summed in order
+    for (k = first; k < count; ++k)
+        _nodes[k] += _nodes[k - 1];
+
+    _dist = Math::Abs(_right - _left) + Math::Abs(_bottom - _top);
 }
 
 /// <summary>
@@ -85,51 +140,34 @@ void CuspData::SetTanLinks(double rError)
     if (rError < 1.0)
         rError = 1.0;
 
-    for (int i = 0; i < count; ++i)
+    // Points appended since the last call only link the points before them
+    // that didn't find a point far enough ahead yet
+    if (rError != _tanError)
     {
-        // Find a StylusPoint at distance-_span forward
-        for (int j = i + 1; j < count; j++)
-        {
-            if (_nodes[j] - _nodes[i] >= rError)
-            {
-                //CDataPoint cdp = _points[i];
-                _points[i].TanNext = j;
-                //_points[i] = cdp;
-
-                //CDataPoint cdp2 = _points[j];
-                _points[j].TanPrev = i;
-                //_points[j] = cdp2;
-                break;
-            }
-        }
-
-        if (0 > _points[i].TanPrev)
+        for (int i = 0; i < count; ++i)
         {
-            for (int j = i - 1; 0 <= j; --j)
-            {
-                if (_nodes[i] - _nodes[j] >= rError)
-                {
-                    //CDataPoint cdp = _points[i];
-                    _points[i].TanPrev = j;
-                    //_points[i] = cdp;
-                    break;
-                }
-            }
+            _points[i].TanPrev = 0;
+            _points[i].TanNext = 0;
         }
+        _tanError = rError;
+        _tanLinked = 0;
+    }
 
-        if (0 > _points[i].TanNext)
-        {
-            //CDataPoint cdp = _points[i];
-            _points[i].TanNext = count - 1;
-            //_points[i] = cdp;
-        }
+    // The StylusPoint at distance-rError forward only moves forward with i,
+    // once there is none the points after i have none either
+    int j = _tanLinked > 0 ? _points[_tanLinked - 1].TanNext : 0;
+    for (int i = _tanLinked; i < count; ++i)
+    {
+        if (j <= i)
+            j = i + 1;
+        while (j < count && !(_nodes[j] - _nodes[i] >= rError))
+            ++j;
+        if (j >= count)
+            break;
 
-        if (0 > _points[i].TanPrev)
-        {
-            //CDataPoint cdp = _points[i];
-            _points[i].TanPrev = 0;
-            //_points[i] = cdp;
-        }
+        _points[i].TanNext = j;
+        _points[j].TanPrev = i;
+        _tanLinked = i + 1;
     }
 }
 
@@ -279,35 +317,62 @@ double CuspData::GetCurvature(int iPrev, int iCurrent, int iNext)
 /// </summary>
 void CuspData::FindAllCusps()
 {
-    // Clear the existing cusp indices
-    _cusps.Clear();
-
-    // There is nothing to find out from
-    if (1 > Count())
-        return;
-
-    // First StylusPoint is always a cusp
-    _cusps.Add(0);
+    _scanPoint = -1;
+    ResumeCuspScan();
+}
 
+/// <summary>
+/// Finds the cusps from the last settled position of the scan on. Cusps found
+/// while all probes of the scan stayed within the points stay the same when
+/// points are appended, the scan position after them is kept and the next
+/// scan resumes there.
+/// </summary>
+void CuspData::ResumeCuspScan()
+{
     int iPrev = 0, iNext = 0, iCuspPrev = 0;
+    int iPoint;
 
-    // Find the next StylusPoint for Index 0
-    // The following check will cover coincident points, stroke with
-    // less than 3 points
-    if (!FindNextAndPrev(0, iCuspPrev, iPrev, iNext))
+    if (_scanPoint < 0)
     {
-        // Point count is zero, thus, there can't be any cusps
-        if (0 == Count())
-            _cusps.Clear();
-        else if (1 < Count()) // Last StylusPoint is always a cusp
-            _cusps.Add(iNext);
+        // Clear the existing cusp indices
+        _cusps.Clear();
 
-        return;
+        // There is nothing to find out from
+        if (1 > Count())
+            return;
+
+        // First StylusPoint is always a cusp
+        _cusps.Add(0);
+
+        // Find the next StylusPoint for Index 0
+        // The following check will cover coincident points, stroke with
+        // less than 3 points
+        if (!FindNextAndPrev(0, iCuspPrev, iPrev, iNext))
+        {
+            // Point count is zero, thus, there can't be any cusps
+            if (0 == Count())
+                _cusps.Clear();
+            else if (1 < Count()) // Last StylusPoint is always a cusp
+                _cusps.Add(iNext);
+
+            return;
+        }
+
+        // Start the algorithm with the next StylusPoint
+        iPoint = iNext;
+        _scanPoint = iPoint;
+        _scanCuspPrev = iCuspPrev;
+        _scanCusps = _cusps.Count();
+    }
+    else
+    {
+        _cusps.RemoveRange(_scanCusps, _cusps.Count() - _scanCusps);
+        iPoint = _scanPoint;
+        iCuspPrev = _scanCuspPrev;
     }
 
-    // Start the algorithm with the next StylusPoint
-    int iPoint = iNext;
     double rCurv = 0;
+    bool settled = true;
 
     // Check all the points on the chord of the stroke
     while (FindNextAndPrev(iPoint, iCuspPrev, iPrev, iNext))
@@ -335,8 +400,13 @@ void CuspData::FindAllCusps()
                 break;
             }
 
-            for (int i = iPrev + 1; (i <= m) && FindNextAndPrev(i, iCuspPrev, iPrev, iNext); ++i)
+            for (int i = iPrev + 1; i <= m; ++i)
             {
+                if (!FindNextAndPrev(i, iCuspPrev, iPrev, iNext))
+                {
+                    settled = false;
+                    break;
+                }
                 rCurv = GetCurvature(iPrev, i, iNext);
                 if (rCurv > rMaxCurv)
                 {
@@ -359,12 +429,26 @@ void CuspData::FindAllCusps()
         }
         else
             ++iPoint;
+
+        if (settled)
+        {
+            _scanPoint = iPoint;
+            _scanCuspPrev = iCuspPrev;
+            _scanCusps = _cusps.Count();
+        }
     }
 
     // If everything went right, add the last StylusPoint to the list of cusps
     _cusps.Add(Count() - 1);
 }
 
+/// <summary>
+/// The last cusp that stays a cusp when points are appended, -1 if none
+/// </summary>
+int CuspData::SettledCusp() const
+{
+    return _scanPoint < 0 ? -1 : _cusps[_scanCusps - 1];
+}
 
 /// <summary>
 /// Finds the next and previous data StylusPoint Index for the given data Index
@@ -378,16 +462,17 @@ bool CuspData::FindNextAndPrev(int iPoint, int iPrevCusp, int & iPrev, int & iNe
 {
     bool bHasMore = true;
 
+    if (_probeSpan != _span || _prevProbe.Count() != Count())
+        UpdateProbes();
+
     if (iPoint >= Count())
     {
         bHasMore = false;
         iPoint = Count() - 1;
     }
 
-    // Find a StylusPoint at distance-_span forward
-    for (iNext = iPoint + 1; iNext < Count(); ++iNext)
-        if (_nodes[iNext] - _nodes[iPoint] >= _span)
-            break;
+    // A StylusPoint at distance-_span forward
+    iNext = _nextProbe[iPoint];
 
     if (iNext >= Count())
     {
@@ -395,9 +480,11 @@ bool CuspData::FindNextAndPrev(int iPoint, int iPrevCusp, int & iPrev, int & iNe
         iNext = Count() - 1;
     }
 
-    for (iPrev = iPoint - 1; iPrevCusp <= iPrev; --iPrev)
-        if (_nodes[iPoint] - _nodes[iPrev] >= _span)
-            break;
+    // The last StylusPoint at distance-_span backward, not before the
+    // previous cusp, else the one just before the cusp or iPoint
+    iPrev = _prevProbe[iPoint];
+    if (iPrev < iPrevCusp)
+        iPrev = iPoint < iPrevCusp ? iPoint - 1 : iPrevCusp - 1;
 
     if (iPrev < 0)
         iPrev = 0;
@@ -405,32 +492,67 @@ bool CuspData::FindNextAndPrev(int iPoint, int iPrevCusp, int & iPrev, int & iNe
     return bHasMore;
 }
 
-
-void CuspData::SetLinks(double rSpan)
+/// <summary>
+/// Finds the probes of all points in two sweeps, the distances along the
+/// stroke only grow with the Index so neither probe ever moves back.
+/// Appended points only extend the backward probes and the forward probes
+/// of the points that had no point a span ahead.
+/// </summary>
+void CuspData::UpdateProbes()
 {
-    // NOP, if there is only one StylusPoint
     int count = Count();
 
-    if (2 > count)
-        return;
+    if (_probeSpan != _span)
+    {
+        _probeSpan = _span;
+        _nextProbe.Clear();
+        _prevProbe.Clear();
+        _nextProbed = 0;
+    }
 
-    // Set up the links to next and previous probe
-    double rL = XY(0).X();
-    double rT = XY(0).Y();
-    double rR = rL;
-    double rB = rT;
+    int j = _nextProbed > 0 ? _nextProbe[_nextProbed - 1] : 0;
+    _nextProbe.RemoveRange(_nextProbed, _nextProbe.Count() - _nextProbed);
+    for (int i = _nextProbed; i < count; ++i)
+    {
+        if (j <= i)
+            j = i + 1;
+        while (j < count && !(_nodes[j] - _nodes[i] >= _span))
+            ++j;
+        _nextProbe.Add(j);
+        if (j < count)
+            _nextProbed = i + 1;
+    }
 
-    for (int i = 0; i < count; ++i)
+    j = _prevProbe.Count() > 0 ? _prevProbe[_prevProbe.Count() - 1] : -1;
+    for (int i = _prevProbe.Count(); i < count; ++i)
     {
-        UpdateMinMax(XY(i).X(), rL, rR);
-        UpdateMinMax(XY(i).Y(), rT, rB);
+        while (j + 1 < i && _nodes[i] - _nodes[j + 1] >= _span)
+            ++j;
+        _prevProbe.Add(j);
     }
+}
+
+
+void CuspData::SetLinks(double rSpan)
+{
+    // NOP, if there is only one StylusPoint
+    if (2 > Count())
+        return;
+
+    SetSpan(GetSpan(rSpan));
+}
+
+/// <summary>
+/// The distance between probes SetLinks uses for the points so far
+/// </summary>
+/// <param name="rSpan">Shortest distance between two distinct points, 0 for the default</param>
+double CuspData::GetSpan(double rSpan) const
+{
+    int count = Count();
+    double span = 3; // Default span
 
-    rR -= rL;
-    rB -= rT;
-    _dist = Math::Abs(rR) + Math::Abs(rB);
     if (false == DoubleUtil::IsZero(rSpan))
-        _span = rSpan;
+        span = rSpan;
     else if (0 < _dist)
     {
         /***
@@ -447,13 +569,28 @@ void CuspData::SetLinks(double rSpan)
         co-ordinate, the span would have been 1.41, which works fairly well in
         cusp detection
         ***/
-        _span = 0.75 * (_nodes[count - 1] * _nodes[count - 1]) / (count * _dist);
+        span = 0.75 * (_nodes[count - 1] * _nodes[count - 1]) / (count * _dist);
     }
 
-    if (_span < 1.0)
-        _span = 1.0;
+    if (span < 1.0)
+        span = 1.0;
+
+    return span;
+}
+
+/// <summary>
+/// Sets the distance between probes and finds the cusps, resuming the last
+/// scan if the span didn't change
+/// </summary>
+void CuspData::SetSpan(double span)
+{
+    if (span != _span)
+    {
+        _span = span;
+        _scanPoint = -1;
+    }
 
-    FindAllCusps();
+    ResumeCuspScan();
 }
 
 INKCANVAS_END_NAMESPACE
@@ -24,6 +24,13 @@ public:
     /// <param name="rSpan">Distance between two consecutive distinct points</param>
     void Analyze(StylusPointCollection & stylusPoints, double rSpan);
 
+    /// <summary>
+    /// Appends points of a stroke being collected, see IncrementalBezier
+    /// </summary>
+    /// <param name="stylusPoints">Points of the stroke</param>
+    /// <param name="start">First point not added yet</param>
+    void AddPoints(StylusPointCollection const & stylusPoints, int start);
+
     /// <summary>
     /// Set links amongst the points for tangent computation
     /// </summary>
@@ -121,6 +128,40 @@ public:
     /// </summary>
     void FindAllCusps();
 
+    /// <summary>
+    /// Finds the cusps, resuming from where the last scan settled
+    /// </summary>
+    void ResumeCuspScan();
+
+    /// <summary>
+    /// The last cusp that stays a cusp when points are appended, -1 if none
+    /// </summary>
+    int SettledCusp() const;
+
+    /// <summary>
+    /// Number of points whose tangent links stay the same when points are appended
+    /// </summary>
+    int TanLinkedCount() const
+    {
+        return _tanLinked;
+    }
+
+    /// <summary>
+    /// Next point Index for tangent computation at Index i
+    /// </summary>
+    int TanNext(int i) const
+    {
+        return _points[i].TanNext;
+    }
+
+    /// <summary>
+    /// Distance between probes for curvature checking
+    /// </summary>
+    double Span() const
+    {
+        return _span;
+    }
+
 
     /// <summary>
     /// Finds the next and previous data StylusPoint Index for the given data Index
@@ -151,7 +192,23 @@ public:
     /// <param name="rSpan">Shortest distance between two distinct points</param>
     void SetLinks(double rSpan);
 
+    /// <summary>
+    /// The distance between probes SetLinks uses for the points so far
+    /// </summary>
+    /// <param name="rSpan">Shortest distance between two distinct points, 0 for the default</param>
+    double GetSpan(double rSpan) const;
+
+    /// <summary>
+    /// Sets the distance between probes and finds the cusps
+    /// </summary>
+    void SetSpan(double span);
+
 private:
+    /// <summary>
+    /// Brings the probes of FindNextAndPrev up to date with the points and span
+    /// </summary>
+    void UpdateProbes();
+
     struct CDataPoint
     {
         Point      Point;       // Point (coordinates are double)
@@ -169,6 +226,31 @@ private:
     // Distance between probes for curvature checking
     double _span = 3; // Default span
 
+    // Running bounds of the points, for _dist
+    double _left = 0;
+    double _top = 0;
+    double _right = 0;
+    double _bottom = 0;
+    Point _lastPoint;
+
+    // Settled state of the cusp scan: position, previous cusp and number of
+    // cusps found, _scanPoint < 0 if the scan starts over
+    int _scanPoint = -1;
+    int _scanCuspPrev = 0;
+    int _scanCusps = 0;
+
+    // Probes for _probeSpan: per point the first point a span ahead, Count()
+    // if none yet, and the last point a span behind, -1 if none. The first
+    // _nextProbed forward probes stay the same when points are appended.
+    double _probeSpan = -1;
+    List<int> _nextProbe;
+    List<int> _prevProbe;
+    int _nextProbed = 0;
+
+    // Tangent links of points [0, _tanLinked) are set for _tanError
+    double _tanError = -1;
+    int _tanLinked = 0;
+
 };
 
 INKCANVAS_END_NAMESPACE
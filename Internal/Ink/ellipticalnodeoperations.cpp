@@ -1,4 +1,5 @@
 #include "Internal/Ink/ellipticalnodeoperations.h"
+#include "Internal/Ink/strokenodebatch.h"
 #include "Internal/debug.h"
 
 INKCANVAS_BEGIN_NAMESPACE
@@ -145,17 +146,33 @@ Quad EllipticalNodeOperations::GetConnectingQuad(StrokeNodeData const & beginNod
                     beginNode.Position() + (vectorToRightTangent * beginRadius));
 }
 
+/// <summary>
+/// Finds connecting quads for the adjacent nodes of a run, with the
+/// batch kernels when the node shape is a circle
+/// </summary>
+void EllipticalNodeOperations::GetConnectingQuads(double const * x, double const * y, double const * pressureFactor, int count, Quad * quads)
+{
+    if (_nodeShapeToCircle.IsIdentity() && _circleToNodeShape.IsIdentity())
+    {
+        StrokeNodeBatch::GetCircleConnectingQuads(_radius, x, y, pressureFactor, count, quads);
+    }
+    else
+    {
+        StrokeNodeOperations::GetConnectingQuads(x, y, pressureFactor, count, quads);
+    }
+}
+
 /// <summary>
 ///
 /// </summary>
 /// <param name="node"></param>
 /// <param name="quad"></param>
-/// <returns></returns>
-List<ContourSegment> EllipticalNodeOperations::GetContourSegments(StrokeNodeData const & node, Quad const& quad)
+/// <param name="result">receives the segments, cleared first</param>
+void EllipticalNodeOperations::GetContourSegments(StrokeNodeData const & node, Quad const& quad, ContourSegmentBuffer & result)
 {
     Debug::Assert(node.IsEmpty() == false);
 
-    List<ContourSegment> result;
+    result.Clear();
     if (quad.IsEmpty())
     {
         Point point = node.Position();
@@ -169,7 +186,6 @@ List<ContourSegment> EllipticalNodeOperations::GetContourSegments(StrokeNodeData
         result.Add(ContourSegment(quad.C(), quad.D()));
         result.Add(ContourSegment(quad.D(), quad.A()));
     }
-    return result;
 }
 
 /// <summary>
@@ -177,11 +193,11 @@ List<ContourSegment> EllipticalNodeOperations::GetContourSegments(StrokeNodeData
 /// </summary>
 /// <param name="beginNode"></param>
 /// <param name="endNode"></param>
-/// <returns></returns>
-List<ContourSegment> EllipticalNodeOperations::GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode)
+/// <param name="result">receives the segments, cleared first</param>
+void EllipticalNodeOperations::GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode, ContourSegmentBuffer & result)
 {
     Quad quad = beginNode.IsEmpty() ? Quad::Empty() : StrokeNodeOperations::GetConnectingQuad(beginNode, endNode);
-    return StrokeNodeOperations::GetContourSegments(endNode, quad);
+    StrokeNodeOperations::GetContourSegments(endNode, quad, result);
 }
 
 
@@ -261,7 +277,7 @@ bool EllipticalNodeOperations::HitTest(
 /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
 /// <returns>true if the contours intersect or overlap</returns>
 bool EllipticalNodeOperations::HitTest(
-    StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, List<ContourSegment> const & hitContour)
+    StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, ContourSegmentBuffer const & hitContour)
 {
     StrokeNodeData bigNode, smallNode;
     double bigRadiusSquared, smallRadiusSquared = 0;
@@ -445,7 +461,7 @@ StrokeFIndices EllipticalNodeOperations::CutTest(
 /// <param name="hitContour">The hitting ContourSegments</param>
 /// <returns>StrokeFIndices representing the location for cutting</returns>
 StrokeFIndices EllipticalNodeOperations::CutTest(
-    StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, List<ContourSegment> const & hitContour)
+    StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, ContourSegmentBuffer const & hitContour)
 {
     // Compute the positions of the beginNode relative to the endNode.
     Vector spineVector = beginNode.IsEmpty() ? Vector(0, 0) : (beginNode.Position() - endNode.Position());
@@ -34,21 +34,27 @@ public:
     /// <returns>connecting quadrangle</returns>
     virtual Quad GetConnectingQuad(StrokeNodeData const & beginNode, StrokeNodeData const & endNode) override;
 
+    /// <summary>
+    /// Finds connecting quads for the adjacent nodes of a run, with the
+    /// batch kernels when the node shape is a circle
+    /// </summary>
+    virtual void GetConnectingQuads(double const * x, double const * y, double const * pressureFactor, int count, Quad * quads) override;
+
     /// <summary>
     ///
     /// </summary>
     /// <param name="node"></param>
     /// <param name="quad"></param>
-    /// <returns></returns>
-    virtual List<ContourSegment> GetContourSegments(StrokeNodeData const &node, Quad const& quad) override;
+    /// <param name="result">receives the segments, cleared first</param>
+    virtual void GetContourSegments(StrokeNodeData const &node, Quad const& quad, ContourSegmentBuffer & result) override;
 
     /// <summary>
     /// ISSUE-2004/06/15- temporary workaround to avoid hit-testing ellipses with ellipses
     /// </summary>
     /// <param name="beginNode"></param>
     /// <param name="endNode"></param>
-    /// <returns></returns>
-    virtual List<ContourSegment> GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode) override;
+    /// <param name="result">receives the segments, cleared first</param>
+    virtual void GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode, ContourSegmentBuffer & result) override;
 
 
     /// <summary>
@@ -74,7 +80,7 @@ public:
     /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
     /// <returns>true if the contours intersect or overlap</returns>
     virtual bool HitTest(
-        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad  const& quad, List<ContourSegment> const & hitContour) override;
+        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad  const& quad, ContourSegmentBuffer const & hitContour) override;
 
     /// <summary>
     /// Cut-test ink segment defined by two nodes and a connecting Quad & against a linear segment
@@ -98,7 +104,7 @@ public:
     /// <param name="hitContour">The hitting ContourSegments</param>
     /// <returns>StrokeFIndices representing the location for cutting</returns>
     virtual StrokeFIndices CutTest(
-        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, List<ContourSegment> const & hitContour) override;
+        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, ContourSegmentBuffer const & hitContour) override;
 
     /// <summary>
     /// Clip-Testing a circluar inking segment against a linear segment.
@@ -4,6 +4,7 @@
 #include "Windows/Ink/stylusshape.h"
 #include "Windows/Ink/incrementalhittester.h"
 #include "Windows/Controls/inkevents.h"
+#include "Windows/Controls/inkpresenter.h"
 #include "Internal/Ink/pencursormanager.h"
 #include "Internal/Ink/strokenode.h"
 #include "Internal/Ink/strokenodeoperations.h"
@@ -193,6 +194,7 @@ void EraserBehavior::StylusInputBegin(SharedPointer<StylusPointCollection> stylu
 
     if ( InkCanvasEditingMode::EraseByPoint == _cachedEraseMode )
     {
+        _batchPointErase = GetInkCanvas().PointEraseBatchingEnabled();
         QObject::connect(_incrementalStrokeHitTester.get(), &IncrementalStrokeHitTester::StrokeHit,
                          this, &EraserBehavior::OnPointEraseResultChanged);
         //_incrementalStrokeHitTester->StrokeHit += new StrokeHitEventHandler(OnPointEraseResultChanged);
@@ -265,6 +267,15 @@ void EraserBehavior::StylusInputEnd(bool)
     _incrementalStrokeHitTester->EndHitTesting();
     _incrementalStrokeHitTester = nullptr;
 
+    // Apply the erase session now that nobody hit-tests against the strokes.
+    // Also when cancelled: unbatched, each erase is applied as it happens and
+    // a cancel keeps what was erased so far
+    if ( _batchPointErase )
+    {
+        _batchPointErase = false;
+        CommitPointErases();
+    }
+
     GetEditingCoordinator().InvalidateBehaviorCursor(this);
 }
 
@@ -415,6 +426,13 @@ void EraserBehavior::OnPointEraseResultChanged(StrokeHitEventArgs& e)
         }
     });
     //try
+    if ( _batchPointErase )
+    {
+        AccumulatePointErase(e);
+
+        fSucceeded = true;
+    }
+    else
     {
 
         InkCanvasStrokeErasingEventArgs args(e.HitStroke());
@@ -471,4 +489,82 @@ void EraserBehavior::OnPointEraseResultChanged(StrokeHitEventArgs& e)
     //}
 }
 
+/// <summary>
+/// Adds the hit fragments to the pending erase of the hit stroke
+/// </summary>
+/// <param name="e"></param>
+void EraserBehavior::AccumulatePointErase(StrokeHitEventArgs& e)
+{
+    SharedPointer<Stroke> stroke = e.HitStroke();
+
+    if ( _cancelledPointErases.contains(stroke) )
+    {
+        return;
+    }
+
+    // Ask only once per stroke and session, the answer holds until the stylus is up
+    if ( !_pendingPointErases.contains(stroke) )
+    {
+        InkCanvasStrokeErasingEventArgs args(stroke);
+        GetInkCanvas().RaiseStrokeErasing(args);
+
+        if ( args.Cancel() )
+        {
+            _cancelledPointErases.append(stroke);
+            return;
+        }
+    }
+
+    // The hit tester keeps testing the original stroke, so the fragments of
+    // every move are in its findices and simply add up. The leftovers change
+    // only when the union grows
+    List<StrokeIntersection>& hitSegments = _pendingPointErases[stroke];
+    if ( StrokeIntersection::UnionHitSegments(hitSegments, e.HitFragments()) )
+    {
+        GetInkCanvas().GetInkPresenter().SetErasePreview(stroke, stroke->Erase(hitSegments.ToArray()));
+    }
+}
+
+/// <summary>
+/// Replaces each stroke of the erase session with its leftovers
+/// </summary>
+void EraserBehavior::CommitPointErases()
+{
+    QMap<SharedPointer<Stroke>, List<StrokeIntersection>> pendingPointErases;
+    pendingPointErases.swap(_pendingPointErases);
+    _cancelledPointErases.clear();
+
+    bool erased = false;
+    for ( auto iter = pendingPointErases.begin(); iter != pendingPointErases.end(); ++iter )
+    {
+        SharedPointer<Stroke> stroke = iter.key();
+
+        // The stroke could have been removed by a StrokeErasing handler meanwhile
+        if ( GetInkCanvas().Strokes()->IndexOf(stroke) < 0 )
+        {
+            GetInkCanvas().GetInkPresenter().SetErasePreview(stroke, nullptr);
+            continue;
+        }
+
+        SharedPointer<StrokeCollection> eraseResult = stroke->Erase(iter.value().ToArray());
+
+        // replace or remove the stroke, its visual and preview go with it
+        if (eraseResult->Count() > 0)
+        {
+            GetInkCanvas().Strokes()->Replace(stroke, eraseResult);
+        }
+        else
+        {
+            GetInkCanvas().Strokes()->Remove(stroke);
+        }
+        erased = true;
+    }
+
+    if ( erased )
+    {
+        //raise ink erased
+        GetInkCanvas().RaiseInkErased();
+    }
+}
+
 INKCANVAS_END_NAMESPACE
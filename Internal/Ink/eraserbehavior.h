@@ -4,6 +4,8 @@
 #include "Internal/Ink/styluseditingbehavior.h"
 #include "Windows/Ink/incrementalhittester.h"
 
+#include <QMap>
+
 class QPolygonF;
 
 INKCANVAS_BEGIN_NAMESPACE
@@ -135,6 +137,20 @@ private:
     /// <param name="e"></param>
     void OnPointEraseResultChanged(StrokeHitEventArgs& e);
 
+    /// <summary>
+    /// Adds the hit fragments to the pending erase of the hit stroke and
+    /// renders its leftovers, the stroke collection is not changed
+    /// </summary>
+    /// <param name="e"></param>
+    void AccumulatePointErase(StrokeHitEventArgs& e);
+
+    /// <summary>
+    /// Replaces each stroke of the erase session with its leftovers, one
+    /// Replace per stroke. Called on cancel too, like unbatched erasing the
+    /// erases so far are kept
+    /// </summary>
+    void CommitPointErases();
+
     //#endregion Methods
 
     //-------------------------------------------------------------------------------
@@ -152,6 +168,11 @@ private:
     StylusShape*                     _cachedStylusShape = nullptr;
     SharedPointer<StylusPointCollection>           _stylusPoints = nullptr;
 
+    // Point erase session, see InkCanvas::PointEraseBatchingEnabled
+    bool                             _batchPointErase = false;
+    QMap<SharedPointer<Stroke>, List<StrokeIntersection>>   _pendingPointErases;
+    QList<SharedPointer<Stroke>>     _cancelledPointErases;
+
     //#endregion Fields
 };
 
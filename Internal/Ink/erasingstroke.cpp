@@ -57,6 +57,11 @@ void ErasingStroke::MoveTo(List<Point>const & path)
         _bounds.Union(strokeNode.GetBoundsConnected());
         _erasingStrokeNodes.Add(strokeNode);
     }
+    _erasingContours.resize(static_cast<size_t>(_erasingStrokeNodes.Count()));
+    for (int i = 0; i < _erasingStrokeNodes.Count(); i++)
+    {
+        _erasingStrokeNodes[i].GetContourSegments(_erasingContours[static_cast<size_t>(i)]);
+    }
 #if POINTS_FILTER_TRACE
     _totalPointsAdded += path.Length;
     //System.Diagnostics.Debug.WriteLine(String.Format("Total Points added: {0} screened: {1} collinear screened: {2}", _totalPointsAdded, _totalPointsScreened, _collinearPointsScreened));
@@ -78,21 +83,33 @@ bool ErasingStroke::HitTest(StrokeNodeIterator const & iterator)
         return false;
     }
 
+    StrokeNodeArrays & inkNodes = iterator.MaterializeNodes();
     Rect inkSegmentBounds = Rect::Empty();
     for (int i = 0; i < iterator.Count(); i++)
     {
-        StrokeNode inkStrokeNode = iterator[i];
-        Rect inkNodeBounds = inkStrokeNode.GetBounds();
+        Rect const & inkNodeBounds = inkNodes.Bounds(i);
         inkSegmentBounds.Union(inkNodeBounds);
 
         if (inkSegmentBounds.IntersectsWith(_bounds))
         {
             //
+            StrokeNode inkStrokeNode = iterator[i];
 
+            // The ink node's contour is the same for every erasing node, build
+            // it on the first candidate only
+            bool contourBuilt = false;
             for (StrokeNode& erasingStrokeNode : _erasingStrokeNodes)
             {
-                if (inkSegmentBounds.IntersectsWith(erasingStrokeNode.GetBoundsConnected())
-                    && erasingStrokeNode.HitTest(inkStrokeNode))
+                if (false == inkSegmentBounds.IntersectsWith(erasingStrokeNode.GetBoundsConnected()))
+                {
+                    continue;
+                }
+                if (!contourBuilt)
+                {
+                    inkStrokeNode.GetContourSegments(_inkContour);
+                    contourBuilt = true;
+                }
+                if (erasingStrokeNode.HitTest(_inkContour))
                 {
                     return true;
                 }
@@ -121,28 +138,30 @@ bool ErasingStroke::EraseTest(StrokeNodeIterator const & iterator, List<StrokeIn
         return false;
     }
 
+    StrokeNodeArrays & inkNodes = iterator.MaterializeNodes();
     Rect inkSegmentBounds = Rect::Empty();
     for (int x = 0; x < iterator.Count(); x++)
     {
-        StrokeNode inkStrokeNode = iterator[x];
-        Rect inkNodeBounds = inkStrokeNode.GetBounds();
+        Rect const & inkNodeBounds = inkNodes.Bounds(x);
         inkSegmentBounds.Union(inkNodeBounds);
 
         //qDebug() << "EraseTest: node" << x << inkNodeBounds << inkSegmentBounds;
         if (inkSegmentBounds.IntersectsWith(_bounds))
         {
             //
+            StrokeNode inkStrokeNode = iterator[x];
 
             int index = eraseAt.Count();
-            for (StrokeNode& erasingStrokeNode : _erasingStrokeNodes)
+            for (int e = 0; e < _erasingStrokeNodes.Count(); e++)
             {
+                StrokeNode& erasingStrokeNode = _erasingStrokeNodes[e];
                 if (false == inkSegmentBounds.IntersectsWith(erasingStrokeNode.GetBoundsConnected()))
                 {
                     continue;
                 }
 
                 //qDebug() << "EraseTest: intersects" << erasingStrokeNode.GetBoundsConnected();
-                StrokeFIndices fragment = inkStrokeNode.CutTest(erasingStrokeNode);
+                StrokeFIndices fragment = inkStrokeNode.CutTest(_erasingContours[static_cast<size_t>(e)]);
                 //qDebug() << "EraseTest: fragment" << fragment.ToString();
                 if (fragment.IsEmpty())
                 {
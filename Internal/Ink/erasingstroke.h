@@ -5,6 +5,8 @@
 #include "Internal/Ink/strokenode.h"
 #include "Collections/Generic/list.h"
 
+#include <vector>
+
 INKCANVAS_BEGIN_NAMESPACE
 
 class StylusShape;
@@ -69,6 +71,11 @@ private:
 private:
     StrokeNodeIterator    _nodeIterator;
     List<StrokeNode>      _erasingStrokeNodes;
+    // Contours of _erasingStrokeNodes, built once per move and shared by
+    // all ink nodes cut-tested in EraseTest
+    std::vector<ContourSegmentBuffer> _erasingContours;
+    // Contour of the current ink node in HitTest, reused across nodes
+    ContourSegmentBuffer  _inkContour;
     Rect                  _bounds = Rect::Empty();
 
 #if POINTS_FILTER_TRACE
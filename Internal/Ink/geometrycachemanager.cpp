@@ -0,0 +1,99 @@
+#include "Internal/Ink/geometrycachemanager.h"
+#include "Windows/Ink/stroke.h"
+
+#include <atomic>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+static std::atomic<size_t> s_budget(0);
+
+// Most recently used at the head
+static GeometryCacheManager::Entry * s_head = nullptr;
+static GeometryCacheManager::Entry * s_tail = nullptr;
+static size_t s_cachedBytes = 0;
+
+size_t GeometryCacheManager::Budget()
+{
+    return s_budget.load(std::memory_order_relaxed);
+}
+
+void GeometryCacheManager::SetBudget(size_t bytes)
+{
+    s_budget.store(bytes, std::memory_order_relaxed);
+    Trim(nullptr);
+}
+
+size_t GeometryCacheManager::CachedBytes()
+{
+    return s_cachedBytes;
+}
+
+void GeometryCacheManager::Add(Entry & entry, Stroke * stroke, size_t bytes)
+{
+    Remove(entry);
+    entry.stroke_ = stroke;
+    entry.bytes_ = bytes;
+    s_cachedBytes += bytes;
+    Link(entry);
+    Trim(&entry);
+}
+
+void GeometryCacheManager::Touch(Entry & entry)
+{
+    if (entry.stroke_ == nullptr || s_head == &entry)
+        return;
+    Unlink(entry);
+    Link(entry);
+}
+
+void GeometryCacheManager::Remove(Entry & entry)
+{
+    if (entry.stroke_ == nullptr)
+        return;
+    Unlink(entry);
+    s_cachedBytes -= entry.bytes_;
+    entry.stroke_ = nullptr;
+    entry.bytes_ = 0;
+}
+
+void GeometryCacheManager::Link(Entry & entry)
+{
+    entry.prev_ = nullptr;
+    entry.next_ = s_head;
+    if (s_head)
+        s_head->prev_ = &entry;
+    else
+        s_tail = &entry;
+    s_head = &entry;
+}
+
+void GeometryCacheManager::Unlink(Entry & entry)
+{
+    if (entry.prev_)
+        entry.prev_->next_ = entry.next_;
+    else
+        s_head = entry.next_;
+    if (entry.next_)
+        entry.next_->prev_ = entry.prev_;
+    else
+        s_tail = entry.prev_;
+    entry.prev_ = entry.next_ = nullptr;
+}
+
+void GeometryCacheManager::Trim(Entry * keep)
+{
+    size_t budget = Budget();
+    if (budget == 0)
+        return;
+    // The geometry just added stays, even alone over the budget, its
+    //  stroke is about to draw it
+    while (s_cachedBytes > budget && s_tail && s_tail != keep)
+    {
+        Entry * entry = s_tail;
+        Stroke * stroke = entry->stroke_;
+        Remove(*entry);
+        stroke->EvictGeometry();
+    }
+}
+
+INKCANVAS_END_NAMESPACE
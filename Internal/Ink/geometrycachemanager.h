@@ -0,0 +1,84 @@
+#ifndef GEOMETRYCACHEMANAGER_H
+#define GEOMETRYCACHEMANAGER_H
+
+#include "InkCanvas_global.h"
+
+#include <cstddef>
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+class Stroke;
+
+/// <summary>
+/// Keeps the geometries cached by all strokes within a memory budget. Each
+/// stroke with a cached geometry holds an entry in a least recently used
+/// list; when the geometries together get larger than the budget, those of
+/// the strokes not asked for them the longest are dropped. A stroke builds
+/// its geometry again with StrokeRenderer the next time it is asked for it,
+/// and tells its observers when a drawing still showed the dropped one.
+/// Like the strokes themselves, only used from the UI thread.
+/// </summary>
+class GeometryCacheManager
+{
+public:
+    /// <summary>
+    /// A stroke's place in the list. Copies of a stroke start unlisted.
+    /// </summary>
+    class Entry
+    {
+    public:
+        Entry() {}
+        Entry(Entry const &) {}
+        Entry & operator=(Entry const &) { return *this; }
+
+    private:
+        friend class GeometryCacheManager;
+        Stroke * stroke_ = nullptr;
+        Entry * prev_ = nullptr;
+        Entry * next_ = nullptr;
+        size_t bytes_ = 0;
+    };
+
+    /// <summary>
+    /// Most bytes of cached geometries, 0 (the default) for no limit
+    /// </summary>
+    static size_t Budget();
+
+    /// <summary>
+    /// Sets the budget, dropping geometries right away if they exceed it
+    /// </summary>
+    static void SetBudget(size_t bytes);
+
+    /// <summary>
+    /// Bytes of all geometries cached by strokes
+    /// </summary>
+    static size_t CachedBytes();
+
+    /// <summary>
+    /// Lists stroke's new geometry of bytes as the most recently used,
+    /// then drops older geometries over the budget
+    /// </summary>
+    static void Add(Entry & entry, Stroke * stroke, size_t bytes);
+
+    /// <summary>
+    /// Marks the geometry of entry as the most recently used
+    /// </summary>
+    static void Touch(Entry & entry);
+
+    /// <summary>
+    /// Unlists entry, when its stroke drops the geometry itself
+    /// </summary>
+    static void Remove(Entry & entry);
+
+private:
+    static void Link(Entry & entry);
+
+    static void Unlink(Entry & entry);
+
+    static void Trim(Entry * keep);
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // GEOMETRYCACHEMANAGER_H
@@ -0,0 +1,113 @@
+#include "Internal/Ink/incrementalbezier.h"
+#include "Internal/doubleutil.h"
+
+#ifndef INKCANVAS_CORE
+#include "Internal/Ink/InkSerializedFormat/strokecollectionserializer.h"
+#else
+class StrokeCollectionSerializer
+{
+public:
+    //#region Constants (Static Fields)
+    static constexpr double AvalonToHimetricMultiplier = 2540.0 / 96.0;
+    static constexpr double HimetricToAvalonMultiplier = 96.0 / 2540.0;
+};
+#endif
+
+INKCANVAS_BEGIN_NAMESPACE
+
+IncrementalBezier::IncrementalBezier(double fitError)
+    : _fittingError(fitError)
+{
+}
+
+/// <summary>
+/// Adds the points of stylusPoints not added yet
+/// </summary>
+/// <param name="stylusPoints">Points of the stroke collected so far</param>
+void IncrementalBezier::AddPoints(StylusPointCollection const & stylusPoints)
+{
+    _data.AddPoints(stylusPoints, _pointCount);
+    _pointCount = stylusPoints.Count();
+}
+
+/// <summary>
+/// Fits the points added so far
+/// </summary>
+bool IncrementalBezier::Fit()
+{
+    if (_data.Count() < 2)
+        return false;
+
+    return Fit(_data.GetSpan(_fittingError), CurrentFitError());
+}
+
+/// <summary>
+/// Fits the points added so far for showing them while collected
+/// </summary>
+bool IncrementalBezier::FitPreview()
+{
+    if (_data.Count() < 2)
+        return false;
+
+    double span = _data.GetSpan(_fittingError);
+    double fitError = CurrentFitError();
+    if (_settledPointCount > 0
+            && Math::Abs(span - _span) <= PreviewDrift * _span
+            && Math::Abs(fitError - _fitError) <= PreviewDrift * _fitError)
+    {
+        span = _span;
+        fitError = _fitError;
+    }
+    return Fit(span, fitError);
+}
+
+/// <summary>
+/// The tolerance Bezier::ConstructFromData uses for the points so far
+/// </summary>
+double IncrementalBezier::CurrentFitError() const
+{
+    double fitError = _fittingError;
+    // 3% is the default value
+    if (DoubleUtil::DBL_EPSILON > fitError)
+        fitError = 0.03 * (_data.Distance() * StrokeCollectionSerializer::HimetricToAvalonMultiplier);
+    return fitError;
+}
+
+bool IncrementalBezier::Fit(double span, double fitError)
+{
+    _data.SetSpan(span);
+
+    // Special cases - 2 or 3 points
+    if (_data.Count() <= 3)
+    {
+        _bezier.RemoveBezierPoints(0);
+        _bezier.AddBezierPoint(_data.XY(0));
+        if (_data.Count() == 3)
+            _bezier.AddParabola(_data, 0);
+        else
+            _bezier.AddLine(_data, 0, 1);
+        _settledPointCount = 0;
+        return true;
+    }
+
+    _data.SetTanLinks(0.5 * fitError);
+
+    Bezier::FitState state;
+    if (_settledPointCount > 0 && span == _span && fitError == _fitError)
+    {
+        _bezier.RemoveBezierPoints(_settledPointCount);
+        state = _settled;
+    }
+    else
+    {
+        _bezier.RemoveBezierPoints(0);
+        _bezier.AddBezierPoint(_data.XY(0));
+        _settledPointCount = 0;
+    }
+    _span = span;
+    _fitError = fitError;
+
+    return _bezier.FitSegments(_data, fitError * fitError, state, &_settled, &_settledPointCount);
+}
+
+INKCANVAS_END_NAMESPACE
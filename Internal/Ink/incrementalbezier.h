@@ -0,0 +1,81 @@
+#ifndef INCREMENTALBEZIER_H
+#define INCREMENTALBEZIER_H
+
+#include "Internal/Ink/bezier.h"
+#include "Internal/Ink/cuspdata.h"
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// Fits a Bezier curve to a stroke while its points are collected. Points are
+/// analyzed once as they arrive, and the cusp scan, tangent links and curve
+/// segments that more points can't change are kept between fits, so a fit
+/// only redoes the trailing segments. Fit() gives the same curve as
+/// Bezier::ConstructBezierState on the points so far. Without a fitting
+/// error, the probe span and tolerance follow the stroke's length and bounds
+/// and change with every point; FitPreview() keeps them while they stay
+/// close, for showing the curve while inking.
+/// </summary>
+class IncrementalBezier
+{
+public:
+    /// <summary>
+    /// Constructor
+    /// </summary>
+    /// <param name="fitError">Fitting error, as for Bezier::ConstructBezierState</param>
+    IncrementalBezier(double fitError);
+
+    /// <summary>
+    /// Adds the points of stylusPoints not added yet
+    /// </summary>
+    /// <param name="stylusPoints">Points of the stroke collected so far</param>
+    void AddPoints(StylusPointCollection const & stylusPoints);
+
+    /// <summary>
+    /// Fits the points added so far
+    /// </summary>
+    /// <returns>Whether the algorithm succeeded</returns>
+    bool Fit();
+
+    /// <summary>
+    /// Fits the points added so far with the span and tolerance of the last
+    /// fit while they are within PreviewDrift of the current ones
+    /// </summary>
+    /// <returns>Whether the algorithm succeeded</returns>
+    bool FitPreview();
+
+    /// <summary>
+    /// The curve of the last fit
+    /// </summary>
+    Bezier & GetBezier()
+    {
+        return _bezier;
+    }
+
+    /// <summary>
+    /// Relative change of span or tolerance FitPreview ignores
+    /// </summary>
+    static constexpr double PreviewDrift = 0.25;
+
+private:
+    double CurrentFitError() const;
+
+    bool Fit(double span, double fitError);
+
+private:
+    double _fittingError;
+    int _pointCount = 0;
+    CuspData _data;
+    Bezier _bezier;
+
+    // Span and tolerance of the last fit, and where its settled segments end
+    double _span = 0;
+    double _fitError = 0;
+    Bezier::FitState _settled;
+    int _settledPointCount = 0;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // INCREMENTALBEZIER_H
@@ -6,11 +6,21 @@
 #include "Windows/Controls/inkevents.h"
 #include "Internal/Controls/inkcanvasselectionadorner.h"
 #include "Internal/Ink/editingcoordinator.h"
+#include "Windows/Ink/drawingattributes.h"
+#include "Windows/Controls/inkpresenter.h"
+#include "Windows/Media/drawing.h"
+#include "Windows/Media/drawingcontext.h"
 #include "Internal/Controls/inkcanvasinnercanvas.h"
 #include "Internal/Controls/inkcanvasfeedbackadorner.h"
 #include "Internal/finallyhelper.h"
 #include "Internal/debug.h"
 
+#include <QGraphicsScene>
+#include <QGraphicsView>
+#include <QPainter>
+
+#include <cmath>
+
 INKCANVAS_BEGIN_NAMESPACE
 
 /// <summary>
@@ -30,6 +40,22 @@ InkCanvasSelection::InkCanvasSelection(InkCanvas& inkCanvas)
     _inkCanvas.FeedbackAdorner().UpdateBounds(Rect::Empty());
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+InkCanvasSelection::~InkCanvasSelection()
+{
+    // Strokes keep their observers until told, unlike signal connections
+    if (_selectedStrokes != nullptr)
+    {
+        for ( SharedPointer<Stroke> s : *_selectedStrokes )
+        {
+            s->RemoveObserver(this);
+        }
+    }
+}
+
+#endif
+
 //#endregion Constructors
 
 //-------------------------------------------------------------------------------
@@ -118,6 +144,26 @@ void InkCanvasSelection::StartFeedbackAdorner(Rect const & feedbackRect, InkCanv
     // Now, attach the feedback adorner to the adorner layer. Then update its bounds
     adornerLayer->Add(&feedbackAdorner);
     feedbackAdorner.UpdateBounds(feedbackRect);
+
+    // The preview maps from where the selection was when the editing started
+    _previewSourceRect = feedbackRect;
+
+    // Snapshot the selected strokes once, then drag the image instead of them
+    if ( _bitmapProxyEnabled && SelectedStrokes()->Count() > 0
+        && feedbackRect.Width() > 0 && feedbackRect.Height() > 0 )
+    {
+        // The hollow outline of a selected stroke reaches past its bounds: thin
+        //  tips are drawn at the default size, then half a HollowLineSize wider
+        double const bleed = (DrawingAttributes::DefaultWidth + 1.0) / 2;
+        Rect imageBounds = Rect::Inflate(feedbackRect, bleed, bleed);
+        QImage image = RasterizeStrokes(*SelectedStrokes(), imageBounds, DeviceScale());
+        if ( !image.isNull() )
+        {
+            feedbackAdorner.SetProxyImage(image, imageBounds, feedbackRect);
+            _inkCanvas.GetInkPresenter().SetStrokesVisible(SelectedStrokes(), false);
+            _bitmapProxyActive = true;
+        }
+    }
 }
 
 /// <summary>
@@ -133,6 +179,15 @@ void InkCanvasSelection::UpdateFeedbackAdorner(Rect const & feedbackRect)
 
     // Update the feedback bounds
     _inkCanvas.FeedbackAdorner().UpdateBounds(feedbackRect);
+
+    // Move the selected strokes along by rendering them under a transform, the
+    // stylus points are left alone until CommitChanges bakes the final rectangle
+    if ( _previewEnabled && !_bitmapProxyActive
+        && !_previewSourceRect.IsEmpty() && SelectedStrokes()->Count() > 0 )
+    {
+        _pendingTransform = MapRectToRect(feedbackRect, _previewSourceRect);
+        _inkCanvas.GetInkPresenter().SetPreviewTransform(SelectedStrokes(), _pendingTransform);
+    }
 }
 
 /// <summary>
@@ -152,6 +207,22 @@ void InkCanvasSelection::EndFeedbackAdorner(Rect const & finalRectangle)
     feedbackAdorner.UpdateBounds(Rect::Empty());
     adornerLayer->Remove(&feedbackAdorner);
 
+    // Drop the preview, the strokes are transformed for real below
+    if ( !_pendingTransform.IsIdentity() )
+    {
+        _inkCanvas.GetInkPresenter().SetPreviewTransform(SelectedStrokes(), Matrix());
+        _pendingTransform = Matrix();
+    }
+    _previewSourceRect = Rect::Empty();
+
+    // Drop the proxy, the strokes show up again at their committed place
+    if ( _bitmapProxyActive )
+    {
+        feedbackAdorner.SetProxyImage(QImage(), Rect::Empty(), Rect::Empty());
+        _inkCanvas.GetInkPresenter().SetStrokesVisible(SelectedStrokes(), true);
+        _bitmapProxyActive = false;
+    }
+
     // Commit the new rectange of the selection.
     CommitChanges(finalRectangle, true);
 
@@ -600,8 +671,12 @@ void InkCanvasSelection::QuitListeningToStrokeChanges()
 
     for ( SharedPointer<Stroke> s : *SelectedStrokes() )
     {
+#ifdef INKCANVAS_INK_SIGNALS
         QObject::disconnect(s.get(), &Stroke::Invalidated,
                             this, &InkCanvasSelection::OnStrokeInvalidated);
+#else
+        s->RemoveObserver(this);
+#endif
         //s.Invalidated -= new EventHandler(this.OnStrokeInvalidated);
     }
 }
@@ -620,8 +695,12 @@ void InkCanvasSelection::ListenToStrokeChanges()
 
     for ( SharedPointer<Stroke> s : *SelectedStrokes() )
     {
+#ifdef INKCANVAS_INK_SIGNALS
         QObject::connect(s.get(), &Stroke::Invalidated,
                             this, &InkCanvasSelection::OnStrokeInvalidated);
+#else
+        s->AddObserver(this);
+#endif
         //s.Invalidated += new EventHandler(this.OnStrokeInvalidated);
     }
 }
@@ -764,6 +843,15 @@ void InkCanvasSelection::OnStrokeInvalidated(EventArgs&)
     OnStrokeCollectionChanged(args);
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+void InkCanvasSelection::Stroke_Invalidated(Stroke &, EventArgs & e)
+{
+    OnStrokeInvalidated(e);
+}
+
+#endif
+
 /// <summary>
 /// Our own listener for strokes changed.
 /// This is used so that if someone deletes or modifies a stroke
@@ -781,8 +869,12 @@ void InkCanvasSelection::OnStrokeCollectionChanged(StrokeCollectionChangedEventA
     {
         if ( SelectedStrokes()->Contains(s) )
         {
+#ifdef INKCANVAS_INK_SIGNALS
             QObject::disconnect(s.get(), &Stroke::Invalidated,
                                 this, &InkCanvasSelection::OnStrokeInvalidated);
+#else
+            s->RemoveObserver(this);
+#endif
             //s->Invalidated -= new EventHandler(this.OnStrokeInvalidated);
             s->SetIsSelected(false);
 
@@ -936,6 +1028,69 @@ Matrix InkCanvasSelection::MapRectToRect(Rect const & target, Rect const & sourc
     return Matrix(m11, 0, 0, m22, dx, dy);
 }
 
+/// <summary>
+/// Rasterizes strokes into an image covering bounds, drawn hollow the way the
+/// Renderer draws selected strokes
+/// </summary>
+/// <param name="strokes">The strokes to draw</param>
+/// <param name="bounds">The area the image covers</param>
+/// <param name="scale">Pixels per ink unit, lowered if the image would exceed MaxBitmapProxySize</param>
+/// <returns>A null image if bounds is empty or larger than MaxBitmapProxySize at one pixel per ink unit</returns>
+QImage InkCanvasSelection::RasterizeStrokes(StrokeCollection & strokes, Rect const & bounds, double scale)
+{
+    if ( bounds.IsEmpty() || scale <= 0 )
+        return QImage();
+
+    double maxScale = MaxBitmapProxySize / std::max(bounds.Width(), bounds.Height());
+    if ( maxScale < 1.0 )
+        return QImage();
+    scale = std::min(scale, maxScale);
+
+    int width = static_cast<int>(std::ceil(bounds.Width() * scale));
+    int height = static_cast<int>(std::ceil(bounds.Height() * scale));
+    if ( width <= 0 || height <= 0 )
+        return QImage();
+
+    DrawingGroup drawing;
+    {
+        std::unique_ptr<DrawingContext> dc(drawing.Open());
+        FinallyHelper final([&dc](){
+            dc->Close();
+        });
+        strokes.Draw(*dc, true /*selected, draw as hollow*/);
+    }
+
+    QImage image(width, height, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    QPainter painter(&image);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.scale(scale, scale);
+    painter.translate(-bounds.Left(), -bounds.Top());
+    drawing.Draw(painter);
+    return image;
+}
+
+/// <summary>
+/// Device pixels per ink unit: the scene transform of the inner canvas, the
+/// zoom of the view showing it and the device pixel ratio of that view
+/// </summary>
+double InkCanvasSelection::DeviceScale()
+{
+    QTransform transform = _inkCanvas.InnerCanvas().sceneTransform();
+    double ratio = 1.0;
+    QGraphicsScene* scene = _inkCanvas.InnerCanvas().scene();
+    if ( scene != nullptr && !scene->views().isEmpty() )
+    {
+        QGraphicsView* view = scene->views().first();
+        transform *= view->viewportTransform();
+        ratio = view->devicePixelRatioF();
+    }
+    // the longer of the mapped unit vectors, a rotation doesn't shrink it
+    double sx = std::hypot(transform.m11(), transform.m12());
+    double sy = std::hypot(transform.m21(), transform.m22());
+    return std::max(sx, sy) * ratio;
+}
+
 /// <summary>
 /// Adds/Removes the LayoutUpdated handler according to whether there is selected elements or not.
 /// </summary>
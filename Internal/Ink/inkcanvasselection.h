@@ -8,6 +8,12 @@
 #include "Collections/Generic/list.h"
 #include "sharedptr.h"
 
+#include <QImage>
+
+#ifndef INKCANVAS_INK_SIGNALS
+#include "Internal/Ink/changeobservers.h"
+#endif
+
 // namespace MS.Internal.Ink
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -20,6 +26,9 @@ class StrokeCollectionChangedEventArgs;
 /// InkCanvasSelection
 /// </summary>
 class InkCanvasSelection : public QObject
+#ifndef INKCANVAS_INK_SIGNALS
+        , private StrokeObserver
+#endif
 {
     Q_OBJECT
 public:
@@ -37,6 +46,10 @@ public:
     /// <param name="inkCanvas">inkCanvas</param>
     InkCanvasSelection(InkCanvas& inkCanvas);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    virtual ~InkCanvasSelection() override;
+#endif
+
     //#endregion Constructors
 
     //-------------------------------------------------------------------------------
@@ -67,6 +80,42 @@ public:
     /// </summary>
     Rect SelectionBounds();
 
+    /// <summary>
+    /// Whether the selected strokes are previewed under a pending transform
+    /// while the feedback rubberband is moved or resized
+    /// </summary>
+    bool PreviewEnabled()
+    {
+        return _previewEnabled;
+    }
+    void SetPreviewEnabled(bool value)
+    {
+        _previewEnabled = value;
+    }
+
+    /// <summary>
+    /// The transform the selected strokes are currently rendered under, not yet
+    /// applied to their points. Identity when no preview is in progress.
+    /// Hit-testing against the previewed strokes should map through its inverse.
+    /// </summary>
+    Matrix PendingTransform()
+    {
+        return _pendingTransform;
+    }
+
+    /// <summary>
+    /// Whether a bitmap of the selected strokes is dragged in the feedback
+    /// adorner instead of the strokes, see InkCanvas::SelectionBitmapProxyEnabled
+    /// </summary>
+    bool BitmapProxyEnabled()
+    {
+        return _bitmapProxyEnabled;
+    }
+    void SetBitmapProxyEnabled(bool value)
+    {
+        _bitmapProxyEnabled = value;
+    }
+
     //#endregion Properties
 
     //-------------------------------------------------------------------------------
@@ -219,6 +268,11 @@ public:
     /// </summary>
     void OnStrokeInvalidated(EventArgs& e);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    // StrokeObserver, for the selected strokes
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & e) override;
+#endif
+
     /// <summary>
     /// Our own listener for strokes changed.
     /// This is used so that if someone deletes or modifies a stroke
@@ -269,6 +323,21 @@ public:
     /// <returns>Transform that maps source rectangle to destination rectangle</returns>
     static Matrix MapRectToRect(Rect const & target, Rect const & source);
 
+    /// <summary>
+    /// Rasterizes strokes into an image covering bounds, drawn hollow the way
+    /// the Renderer draws selected strokes
+    /// </summary>
+    /// <param name="strokes">The strokes to draw</param>
+    /// <param name="bounds">The area the image covers</param>
+    /// <param name="scale">Pixels per ink unit, lowered if the image would exceed MaxBitmapProxySize</param>
+    /// <returns>A null image if bounds is empty or larger than MaxBitmapProxySize at one pixel per ink unit</returns>
+    static QImage RasterizeStrokes(StrokeCollection & strokes, Rect const & bounds, double scale);
+
+    /// <summary>
+    /// Device pixels per ink unit, so the proxy image stays sharp under zoom
+    /// </summary>
+    double DeviceScale();
+
     /// <summary>
     /// Adds/Removes the LayoutUpdated handler according to whether there is selected elements or not.
     /// </summary>
@@ -340,6 +409,19 @@ private:
 
     std::pair<InkCanvasSelectionHitResult, bool> _activeSelectionHitResult;
 
+    /// <summary>
+    /// Live preview of moving / resizing, see PreviewEnabled
+    /// </summary>
+    bool                        _previewEnabled = false;
+    Rect                        _previewSourceRect = Rect::Empty();
+    Matrix                      _pendingTransform;
+    bool                        _bitmapProxyEnabled = false;
+    // the strokes are hidden behind the proxy image
+    bool                        _bitmapProxyActive = false;
+
+    // Beyond this the snapshot costs more than it saves, fall back to the rubberband
+    static constexpr int        MaxBitmapProxySize = 4096;
+
     //#endregion Fields
 
 };
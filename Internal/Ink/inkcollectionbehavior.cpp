@@ -1,5 +1,6 @@
 #include "Internal/Ink/inkcollectionbehavior.h"
 #include "Internal/Ink/pencursormanager.h"
+#include "Internal/Ink/incrementalbezier.h"
 #include "Windows/Controls/inkcanvas.h"
 #include "Windows/routedeventargs.h"
 #include "Windows/Ink/drawingattributes.h"
@@ -8,6 +9,7 @@
 #include "Windows/Ink/stroke.h"
 #include "Windows/Controls/inkevents.h"
 #include "Internal/finallyhelper.h"
+#include "Internal/latencytrace.h"
 
 #include <QApplication>
 #include <QScreen>
@@ -247,10 +249,11 @@ void InkCollectionBehavior::StylusInputBegin(SharedPointer<StylusPointCollection
         _userInitiated = true;
     }
 
-    StylusInput(stylusPoints);
-
+    // set before the first points, they are fitted with it
     _strokeDrawingAttributes = GetInkCanvas().DefaultDrawingAttributes()->Clone();
 
+    StylusInput(stylusPoints);
+
     // Reset the dynamic renderer if it's been flagged.
     if ( _resetDynamicRenderer )
     {
@@ -319,6 +322,7 @@ void InkCollectionBehavior::StylusInputEnd(bool commit)
     {
         FinallyHelper final([this](){
             _stylusPoints.clear();
+            _bezierFits.clear();
             _strokeDrawingAttributes = nullptr ;
             _userInitiated = false;
             GetEditingCoordinator().InvalidateBehaviorCursor(this);
@@ -326,20 +330,22 @@ void InkCollectionBehavior::StylusInputEnd(bool commit)
 
         if ( commit )
         {
+            LatencyTrace::Scope trace(LatencyTrace::Commit);
             // NTRAID:WINDOWS#1613731-2006/04/27-WAYNEZEN,
             // It's possible that the input may end up without any StylusPoint being collected since the behavior can be deactivated by
             // the user code in the any event handler.
-            for (auto & spc : _stylusPoints )
+            for (auto it = _stylusPoints.begin(); it != _stylusPoints.end(); ++it)
             {
                 //Debug.Assert(_strokeDrawingAttributes != nullptr , "_strokeDrawingAttributes can not be nullptr , did we not see a down?");
 
-                SharedPointer<Stroke>  stroke(new Stroke(spc, _strokeDrawingAttributes));
+                SharedPointer<Stroke>  stroke = CreateStroke(it.key(), it.value());
 
                 //we don't add the stroke to the InkCanvas stroke collection until RaiseStrokeCollected
                 //since this might be a gesture and in some modes, gestures don't get added
                 InkCanvasStrokeCollectedEventArgs argsStroke(stroke);
                 GetInkCanvas().RaiseGestureOrStrokeCollected(argsStroke, _userInitiated);
             }
+            LatencyTrace::MarkOutput(LatencyTrace::InputToCommit);
         }
     }
     //finally
@@ -355,19 +361,22 @@ void InkCollectionBehavior::StylusInput(SharedPointer<StylusPointCollection> sty
 {
     if (stylusPoints->Description()->HasProperty(Stylus::StylusPointIdPropertyInfo)) {
         QList<int> old = _stylusPoints.keys();
-        for (StylusPoint const & sp : *stylusPoints) {
-            int touchId = sp.GetPropertyValue(Stylus::StylusPointIdPropertyInfo);
-            SharedPointer<StylusPointCollection>& c = _stylusPoints[touchId];
+        // grouped by contact in a copy if needed, the caller's points stay as they are
+        SharedPointer<StylusPointCollection> points = stylusPoints;
+        for (StylusContactRange const & contact : Stylus::GetContactRanges(points)) {
+            SharedPointer<StylusPointCollection>& c = _stylusPoints[contact.id];
             if (c == nullptr) {
                 c.reset(new StylusPointCollection(stylusPoints->Description(), 100));
             } else {
-                old.removeOne(touchId);
+                old.removeOne(contact.id);
             }
-            c->Add(sp);
+            for (int i = contact.start; i < contact.start + contact.count; ++i)
+                c->Add((*points)[i]);
+            FitStylusPoints(contact.id, *c);
         }
         for (int id : old) {
             SharedPointer<StylusPointCollection> spc = _stylusPoints.take(id);
-            SharedPointer<Stroke> stroke(new Stroke(spc, _strokeDrawingAttributes));
+            SharedPointer<Stroke> stroke = CreateStroke(id, spc);
             //we don't add the stroke to the InkCanvas stroke collection until RaiseStrokeCollected
             //since this might be a gesture and in some modes, gestures don't get added
             InkCanvasStrokeCollectedEventArgs argsStroke(stroke);
@@ -379,6 +388,7 @@ void InkCollectionBehavior::StylusInput(SharedPointer<StylusPointCollection> sty
             c.reset(new StylusPointCollection(stylusPoints->Description(), 100));
         }
         c->Add(*stylusPoints);
+        FitStylusPoints(0, *c);
         return;
     }
 
@@ -389,6 +399,7 @@ void InkCollectionBehavior::StylusInput(SharedPointer<StylusPointCollection> sty
         }
         for (int id : g.newPointIds) {
             _stylusPoints.remove(id);
+            _bezierFits.remove(id);
         }
         QRectF shape = g.bound;
         QPointF c = shape.center();
@@ -398,6 +409,46 @@ void InkCollectionBehavior::StylusInput(SharedPointer<StylusPointCollection> sty
     }
 }
 
+/// <summary>
+/// Adds the points collected for contact id to its curve fit
+/// </summary>
+void InkCollectionBehavior::FitStylusPoints(int id, StylusPointCollection const & stylusPoints)
+{
+    if (!_strokeDrawingAttributes->FitToCurve())
+    {
+        return;
+    }
+
+    SharedPointer<IncrementalBezier>& bezier = _bezierFits[id];
+    if (bezier == nullptr)
+    {
+        bezier.reset(new IncrementalBezier(_strokeDrawingAttributes->FittingError()));
+    }
+    bezier->AddPoints(stylusPoints);
+
+    // With a fitting error set, a fit only redoes the segments the new points
+    //  can change, so keep up and leave the stroke's end to the commit. The
+    //  default error follows the stroke's length, it is fitted on commit only.
+    if (_strokeDrawingAttributes->FittingError() > 0)
+    {
+        bezier->Fit();
+    }
+}
+
+/// <summary>
+/// Creates the stroke of contact id
+/// </summary>
+SharedPointer<Stroke> InkCollectionBehavior::CreateStroke(int id, SharedPointer<StylusPointCollection> stylusPoints)
+{
+    SharedPointer<Stroke> stroke(new Stroke(stylusPoints, _strokeDrawingAttributes));
+    SharedPointer<IncrementalBezier> bezier = _bezierFits.take(id);
+    if (bezier != nullptr && bezier->Fit())
+    {
+        stroke->SetFittedBezier(bezier->GetBezier());
+    }
+    return stroke;
+}
+
 /// <summary>
 /// ApplyTransformToCursor
 /// </summary>
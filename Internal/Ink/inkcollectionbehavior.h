@@ -8,6 +8,8 @@
 INKCANVAS_BEGIN_NAMESPACE
 
 class DrawingAttributes;
+class IncrementalBezier;
+class Stroke;
 
 // namespace MS.Internal.Ink
 
@@ -197,6 +199,18 @@ private:
 
     QCursor PenCursor();
 
+    /// <summary>
+    /// Adds the points collected for contact id to its curve fit, when the
+    /// strokes are fitted to curves
+    /// </summary>
+    void FitStylusPoints(int id, StylusPointCollection const & stylusPoints);
+
+    /// <summary>
+    /// Creates the stroke of contact id, with the curve fitted while its
+    /// points were collected
+    /// </summary>
+    SharedPointer<Stroke> CreateStroke(int id, SharedPointer<StylusPointCollection> stylusPoints);
+
     //#endregion Methods
 
 
@@ -232,6 +246,12 @@ private:
     /// </summary>
     SharedPointer<DrawingAttributes>                               _strokeDrawingAttributes;
 
+    /// <summary>
+    /// FitToCurve strokes are fitted while collected, per contact like _stylusPoints,
+    /// so committing them doesn't fit them again
+    /// </summary>
+    QMap<int, SharedPointer<IncrementalBezier>>                    _bezierFits;
+
     /// <summary>
     /// The cached DrawingAttributes and Cursor instances for rendering the pen cursor.
     /// </summary>
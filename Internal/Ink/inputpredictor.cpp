@@ -0,0 +1,70 @@
+#include "Internal/Ink/inputpredictor.h"
+
+#include <cmath>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+void InputPredictor::Reset()
+{
+    _count = 0;
+    _velocity = Vector();
+    _acceleration = Vector();
+}
+
+void InputPredictor::Add(Point const & point, int timestamp)
+{
+    int dt = timestamp - _timestamp;
+    if (_count == 0 || dt > MaxSampleInterval || dt < 0)
+    {
+        // first sample, a rest or a wrapped timestamp
+        _count = 1;
+        _velocity = Vector();
+        _acceleration = Vector();
+    }
+    else if (dt == 0)
+    {
+        // coalesced events: take the position, there is no time to measure speed on
+        _position = point;
+        return;
+    }
+    else
+    {
+        Vector measured = (point - _position) / dt;
+        if (_count == 1)
+        {
+            _velocity = measured;
+        }
+        else
+        {
+            Vector velocity = _velocity + (measured - _velocity) * VelocityGain;
+            _acceleration += ((velocity - _velocity) / dt - _acceleration) * AccelerationGain;
+            _velocity = velocity;
+        }
+        ++_count;
+    }
+    _position = point;
+    _timestamp = timestamp;
+}
+
+bool InputPredictor::Predict(double horizon, double step, List<Point> & points) const
+{
+    if (_count < 2 || horizon <= 0 || _velocity.Length() < MinSpeed)
+        return false;
+
+    // Don't let acceleration dominate, that turns noise into hooks
+    Vector accelerationLimit = _velocity * horizon;
+    Vector acceleration = _acceleration;
+    double limit = accelerationLimit.Length() / (0.5 * horizon * horizon);
+    if (acceleration.Length() > limit)
+        acceleration *= limit / acceleration.Length();
+
+    int n = step > 0 ? static_cast<int>(std::ceil(horizon / step)) : 1;
+    for (int i = 1; i <= n; ++i)
+    {
+        double t = horizon * i / n;
+        points.Add(_position + _velocity * t + acceleration * (0.5 * t * t));
+    }
+    return true;
+}
+
+INKCANVAS_END_NAMESPACE
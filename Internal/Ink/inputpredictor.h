@@ -0,0 +1,57 @@
+#ifndef INPUTPREDICTOR_H
+#define INPUTPREDICTOR_H
+
+#include "InkCanvas_global.h"
+#include "Windows/point.h"
+#include "Windows/vector.h"
+#include "Collections/Generic/list.h"
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// Extrapolates where the pen will be a few milliseconds ahead, from the
+/// positions it reported so far. Velocity and acceleration are tracked with
+/// an alpha-beta filter (a steady state Kalman filter for a constant
+/// acceleration model), so single noisy samples don't swing the prediction.
+/// The predicted points are for display only.
+/// </summary>
+class InputPredictor
+{
+public:
+    /// <summary>
+    /// Forgets the history, call at stylus down
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// Adds a real sample, timestamp in milliseconds
+    /// </summary>
+    void Add(Point const & point, int timestamp);
+
+    /// <summary>
+    /// Appends the predicted positions horizon milliseconds ahead of the last
+    /// sample to points, one every step milliseconds, the last one at horizon.
+    /// Returns false, leaving points alone, if there is no motion to predict.
+    /// </summary>
+    bool Predict(double horizon, double step, List<Point> & points) const;
+
+private:
+    int     _count = 0;
+    Point   _position;
+    Vector  _velocity;      // per millisecond
+    Vector  _acceleration;  // per millisecond squared
+    int     _timestamp = 0;
+
+    // filter gains, higher follows the measurements more closely
+    static constexpr double VelocityGain = 0.6;
+    static constexpr double AccelerationGain = 0.3;
+    // a longer gap means the pen rested, start over from zero velocity
+    static constexpr int    MaxSampleInterval = 50;
+    // below this speed, in units per millisecond, nothing is predicted
+    static constexpr double MinSpeed = 0.01;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // INPUTPREDICTOR_H
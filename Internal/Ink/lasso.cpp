@@ -140,15 +140,17 @@ Array<StrokeIntersection> Lasso::HitTest(StrokeNodeIterator & iterator)
 
     // Creat a list to hold all the crossings
     List<LassoCrossing> crossingList;
+    StrokeNodeArrays & nodes = iterator.MaterializeNodes();
     for (int i = 0; i < iterator.Count(); i++)
     {
-        StrokeNode strokeNode = iterator[i];
-        Rect nodeBounds = strokeNode.GetBounds();
+        Rect const & nodeBounds = nodes.Bounds(i);
         currentStrokeSegmentBounds.Union(nodeBounds);
 
         // Skip the node if it's outside of the lasso's bounds
         if (currentStrokeSegmentBounds.IntersectsWith(_bounds) == true)
         {
+            StrokeNode strokeNode = iterator[i];
+
             // currentStrokeSegmentBounds, made up of the bounding box of
             // this StrokeNode unioned with the last StrokeNode,
             // intersects the lasso bounding box.
@@ -204,7 +206,7 @@ Array<StrokeIntersection> Lasso::HitTest(StrokeNodeIterator & iterator)
 
         // Continue with the next node
         currentStrokeSegmentBounds = nodeBounds;
-        lastNodePosition = strokeNode.Position();
+        lastNodePosition = nodes.NodeData(i).Position();
     }
 
 
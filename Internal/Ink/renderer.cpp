@@ -57,9 +57,11 @@ public:
     /// <summary>
     /// Updates the contents of the visual.
     /// </summary>
-    void Update()
+    /// <param name="inPlace">drawn again after an eviction, with unchanged bounds</param>
+    void Update(bool inPlace = false)
     {
-        std::unique_ptr<DrawingContext> drawingContext(RenderOpen());
+        _evicted = false;
+        std::unique_ptr<DrawingContext> drawingContext(inPlace ? RenderOpenInPlace() : RenderOpen());
         {
             FinallyHelper final([&drawingContext](){
                drawingContext->Close();
@@ -90,11 +92,84 @@ public:
                 da = _stroke->GetDrawingAttributes();
             }
 
+            // Draw what is left of the stroke during a point erase session
+            if (_erasePreview != nullptr)
+            {
+                for (SharedPointer<Stroke> fragment : *_erasePreview)
+                {
+                    fragment->DrawInternal (*drawingContext, da, _stroke->IsSelected() );
+                }
+                return;
+            }
+
+            // Draw the stroke where a selection move or resize would put it,
+            // transformed like InkCanvasSelection::TransformStrokes does so
+            // the tip keeps its size when the transform is committed
+            if (!_previewTransform.IsIdentity())
+            {
+                SharedPointer<Stroke> moved = _stroke->Clone();
+                moved->Transform(_previewTransform, false);
+                moved->DrawInternal (*drawingContext, da, _stroke->IsSelected() );
+                return;
+            }
+
             // Draw selected stroke as hollow
             _stroke->DrawInternal (*drawingContext, da, _stroke->IsSelected() );
         }
     }
 
+    /// <summary>
+    /// Renders fragments in place of the stroke until reset with nullptr,
+    /// the stroke itself is left untouched
+    /// </summary>
+    void SetErasePreview(SharedPointer<StrokeCollection> fragments)
+    {
+        if (fragments == nullptr && _erasePreview == nullptr)
+            return;
+        _erasePreview = fragments;
+        Update();
+    }
+
+    /// <summary>
+    /// Renders the stroke under transform until reset with identity, the
+    /// stroke itself is left untouched
+    /// </summary>
+    void SetPreviewTransform(Matrix const & transform)
+    {
+        if (transform.IsIdentity() && _previewTransform.IsIdentity())
+            return;
+        _previewTransform = transform;
+        Update();
+    }
+
+    /// <summary>
+    /// Lets go of the drawing, and with it the stroke's evicted geometry. The
+    /// stroke is drawn again the next time the visual is painted, so only
+    /// strokes in view hold geometries beyond GeometryCacheManager's budget.
+    /// </summary>
+    void OnGeometryEvicted()
+    {
+        if (_evicted || _erasePreview != nullptr || !_previewTransform.IsIdentity())
+            return;
+        _evictedBounds = DrawingVisual::boundingRect();
+        _evicted = true;
+        DropDrawing();
+    }
+
+    virtual QRectF boundingRect() const override
+    {
+        return _evicted ? _evictedBounds : DrawingVisual::boundingRect();
+    }
+
+    virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = nullptr) override
+    {
+        if (_evicted)
+        {
+            Update(true);
+        }
+        DrawingVisual::paint(painter, option, widget);
+    }
+
 protected:
     /// <summary>
     /// StrokeVisual should not be hittestable as it interferes with event routing
@@ -134,6 +209,10 @@ public:
 
 private:
     SharedPointer<Stroke>                      _stroke;
+    SharedPointer<StrokeCollection>            _erasePreview;
+    Matrix                       _previewTransform;
+    QRectF                       _evictedBounds;
+    bool                        _evicted = false;
     bool                        _cachedIsHighlighter;
     QColor                       _cachedColor;
     Renderer&                    _renderer;
@@ -180,6 +259,19 @@ Renderer::Renderer(QObject * parent)
     //_visuals = new Dictionary<Stroke, StrokeVisual>();
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+Renderer::~Renderer()
+{
+    // Strokes keep their observers until told, unlike signal connections
+    for (SharedPointer<Stroke> const & stroke : _visuals.keys())
+    {
+        StopListeningOnStrokeEvents(stroke);
+    }
+}
+
+#endif
+
 /// <summary>
 /// Returns a reference to a visual tree that can be used to render the ink.
 /// This property may be either a single visual or a container visual with
@@ -339,6 +431,48 @@ void Renderer::DetachIncrementalRendering(Visual* visual)
     DetachVisual(visual);
 }
 
+/// <summary>
+/// Renders the given strokes under transform, without touching their points.
+/// </summary>
+void Renderer::SetPreviewTransform(SharedPointer<StrokeCollection> strokes, Matrix const & transform)
+{
+    for (SharedPointer<Stroke> stroke : *strokes)
+    {
+        StrokeVisual* visual = _visuals.value(stroke, nullptr);
+        if (visual != nullptr)
+        {
+            visual->SetPreviewTransform(transform);
+        }
+    }
+}
+
+/// <summary>
+/// Renders fragments in place of stroke, nullptr resets
+/// </summary>
+void Renderer::SetErasePreview(SharedPointer<Stroke> stroke, SharedPointer<StrokeCollection> fragments)
+{
+    StrokeVisual* visual = _visuals.value(stroke, nullptr);
+    if (visual != nullptr)
+    {
+        visual->SetErasePreview(fragments);
+    }
+}
+
+/// <summary>
+/// Shows or hides the visuals of the given strokes
+/// </summary>
+void Renderer::SetStrokesVisible(SharedPointer<StrokeCollection> strokes, bool visible)
+{
+    for (SharedPointer<Stroke> stroke : *strokes)
+    {
+        StrokeVisual* visual = _visuals.value(stroke, nullptr);
+        if (visual != nullptr)
+        {
+            visual->setVisible(visible);
+        }
+    }
+}
+
 /// <summary>
 /// helper used to indicate if a visual was previously attached
 /// via a call to AttachIncrementalRendering
@@ -464,14 +598,57 @@ void Renderer::OnStrokesChanged(StrokeCollectionChangedEventArgs& eventArgs)
 /// <summary>
 /// Stroke Invalidated event handler
 /// </summary>
+#ifdef INKCANVAS_INK_SIGNALS
+
 void Renderer::OnStrokeInvalidated(EventArgs& eventArgs)
 {
     (void) eventArgs;
     //System.Diagnostics.Debug::Assert(_strokes.IndexOf(sender as Stroke) != -1);
+    InvalidateStrokeVisual(static_cast<Stroke*>(sender())->sharedFromThis());
+}
 
+#else
+
+void Renderer::Stroke_Invalidated(Stroke & stroke, EventArgs& eventArgs)
+{
+    (void) eventArgs;
+    InvalidateStrokeVisual(stroke.sharedFromThis());
+}
+
+#endif
+
+/// <summary>
+/// Stroke GeometryEvicted event handler
+/// </summary>
+#ifdef INKCANVAS_INK_SIGNALS
+
+void Renderer::OnStrokeGeometryEvicted()
+{
+    EvictStrokeVisual(static_cast<Stroke*>(sender())->sharedFromThis());
+}
+
+#else
+
+void Renderer::Stroke_GeometryEvicted(Stroke & stroke)
+{
+    EvictStrokeVisual(stroke.sharedFromThis());
+}
+
+#endif
+
+void Renderer::EvictStrokeVisual(SharedPointer<Stroke> stroke)
+{
+    // May come while another visual is painted and rebuilds its stroke
+    if (_visuals.contains(stroke))
+    {
+        _visuals.value(stroke)->OnGeometryEvicted();
+    }
+}
+
+void Renderer::InvalidateStrokeVisual(SharedPointer<Stroke> stroke)
+{
     // Find the visual associated with the changed stroke.
     StrokeVisual* visual;
-    SharedPointer<Stroke> stroke = static_cast<Stroke*>(sender())->sharedFromThis();
     if (_visuals.contains(stroke) == false)
     {
         throw std::runtime_error("SR.Get(SRID.UnknownStroke1)");
@@ -621,8 +798,14 @@ void Renderer::StartListeningOnStrokeEvents(SharedPointer<Stroke> stroke)
 {
     ////System.Diagnostics.Debug::Assert(stroke != nullptr);
     //stroke.Invalidated += new EventHandler(OnStrokeInvalidated);
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::connect(stroke.get(), &Stroke::Invalidated,
                      this, &Renderer::OnStrokeInvalidated);
+    QObject::connect(stroke.get(), &Stroke::GeometryEvicted,
+                     this, &Renderer::OnStrokeGeometryEvicted);
+#else
+    stroke->AddObserver(this);
+#endif
 }
 
 /// <summary>
@@ -632,8 +815,14 @@ void Renderer::StopListeningOnStrokeEvents(SharedPointer<Stroke> stroke)
 {
     ////System.Diagnostics.Debug::Assert(stroke != nullptr);
     //stroke.Invalidated -= new EventHandler(OnStrokeInvalidated);
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::disconnect(stroke.get(), &Stroke::Invalidated,
                      this, &Renderer::OnStrokeInvalidated);
+    QObject::disconnect(stroke.get(), &Stroke::GeometryEvicted,
+                     this, &Renderer::OnStrokeGeometryEvicted);
+#else
+    stroke->RemoveObserver(this);
+#endif
 }
 
 INKCANVAS_END_NAMESPACE
@@ -9,6 +9,10 @@
 #include <QMap>
 #include <QObject>
 
+#ifndef INKCANVAS_INK_SIGNALS
+#include "Internal/Ink/changeobservers.h"
+#endif
+
 // namespace System.Windows.Ink
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -18,6 +22,7 @@ class Stroke;
 class DrawingAttributes;
 class StrokeCollectionChangedEventArgs;
 class EventArgs;
+class Matrix;
 class ContainerVisual;
 
 /// <summary>
@@ -32,6 +37,9 @@ class ContainerVisual;
 ///
 //[FriendAccessAllowed] // Built into Core, also used by Framework.
 class Renderer : public QObject
+#ifndef INKCANVAS_INK_SIGNALS
+        , private StrokeObserver
+#endif
 {
     Q_OBJECT
     //#region StrokeVisual
@@ -58,6 +66,10 @@ public:
     /// </summary>
     Renderer(QObject * parent);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    virtual ~Renderer() override;
+#endif
+
     /// <summary>
     /// Returns a reference to a visual tree that can be used to render the ink.
     /// This property may be either a single visual or a container visual with
@@ -102,6 +114,27 @@ public:
     /// </summary>
     bool AttachedVisualIsPositionedCorrectly(Visual* visual, SharedPointer<DrawingAttributes> drawingAttributes);
 
+    /// <summary>
+    /// Renders the given strokes under transform, without touching their points.
+    /// Used as a live preview while the selection is moved or resized, pass an
+    /// identity matrix to reset. Like the commit, the transform is not applied
+    /// to the stylus tip.
+    /// </summary>
+    void SetPreviewTransform(SharedPointer<StrokeCollection> strokes, Matrix const & transform);
+
+    /// <summary>
+    /// Shows or hides the visuals of the given strokes, used while a bitmap
+    /// proxy of the selection is dragged in their place
+    /// </summary>
+    void SetStrokesVisible(SharedPointer<StrokeCollection> strokes, bool visible);
+
+    /// <summary>
+    /// Renders fragments in place of stroke without changing the collection,
+    /// used to show a point erase session before it is committed. Pass
+    /// nullptr to render the stroke itself again.
+    /// </summary>
+    void SetErasePreview(SharedPointer<Stroke> stroke, SharedPointer<StrokeCollection> fragments);
+
 
 
     /// <summary>
@@ -143,11 +176,32 @@ private:
     /// </summary>
     void OnStrokesChanged(StrokeCollectionChangedEventArgs& eventArgs);
 
+#ifdef INKCANVAS_INK_SIGNALS
     /// <summary>
     /// Stroke Invalidated event handler
     /// </summary>
     void OnStrokeInvalidated(EventArgs& eventArgs);
 
+    /// <summary>
+    /// Stroke GeometryEvicted event handler
+    /// </summary>
+    void OnStrokeGeometryEvicted();
+#else
+    // StrokeObserver, for the strokes with a visual
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & eventArgs) override;
+    virtual void Stroke_GeometryEvicted(Stroke & stroke) override;
+#endif
+
+    /// <summary>
+    /// Drops the drawing of a stroke whose geometry was evicted
+    /// </summary>
+    void EvictStrokeVisual(SharedPointer<Stroke> stroke);
+
+    /// <summary>
+    /// Updates the visual of an invalidated stroke
+    /// </summary>
+    void InvalidateStrokeVisual(SharedPointer<Stroke> stroke);
+
     //#endregion
 
     //#region Helper methods
@@ -0,0 +1,90 @@
+#include "Internal/Ink/strokegeometrycache.h"
+#include "Windows/Ink/drawingattributes.h"
+#include "Windows/Media/geometry.h"
+#include "Internal/doubleutil.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+StrokeGeometryKey::StrokeGeometryKey()
+{
+}
+
+StrokeGeometryKey::StrokeGeometryKey(DrawingAttributes const & drawingAttributes)
+    : _stylusTip(drawingAttributes.GetStylusTip())
+    , _stylusTipTransform(drawingAttributes.StylusTipTransform())
+    , _width(drawingAttributes.Width())
+    , _height(drawingAttributes.Height())
+    , _drawingFlags(drawingAttributes.GetDrawingFlags())
+{
+}
+
+/// <summary>
+/// Same comparison as DrawingAttributes::GeometricallyEqual
+/// </summary>
+bool StrokeGeometryKey::Matches(DrawingAttributes const & drawingAttributes) const
+{
+    return _stylusTip == drawingAttributes.GetStylusTip() &&
+            _stylusTipTransform == drawingAttributes.StylusTipTransform() &&
+            DoubleUtil::AreClose(_width, drawingAttributes.Width()) &&
+            DoubleUtil::AreClose(_height, drawingAttributes.Height()) &&
+            _drawingFlags == drawingAttributes.GetDrawingFlags();
+}
+
+StrokeGeometryCache::StrokeGeometryCache(void * owner)
+    : _owner(owner)
+{
+}
+
+StrokeGeometryCache::~StrokeGeometryCache()
+{
+    Clear();
+}
+
+Geometry * StrokeGeometryCache::Find(DrawingAttributes const & drawingAttributes)
+{
+    for (int i = 0; i < Capacity; ++i)
+    {
+        if (_geometries[i] != nullptr && _keys[i].Matches(drawingAttributes))
+        {
+            return _geometries[i];
+        }
+    }
+    return nullptr;
+}
+
+void StrokeGeometryCache::Add(DrawingAttributes const & drawingAttributes, Geometry * geometry)
+{
+    if (_geometries[_next] != nullptr)
+    {
+        Drop(_geometries[_next]);
+    }
+    _keys[_next] = StrokeGeometryKey(drawingAttributes);
+    _geometries[_next] = geometry;
+    if (geometry)
+        geometry->tryTakeOwn(_owner);
+    _next = (_next + 1) % Capacity;
+}
+
+void StrokeGeometryCache::Drop(Geometry * geometry)
+{
+    // a drawing still showing it deletes it when done
+    if (geometry->userCount() > 0)
+        geometry->releaseOwn(_owner);
+    else
+        delete geometry;
+}
+
+void StrokeGeometryCache::Clear()
+{
+    for (int i = 0; i < Capacity; ++i)
+    {
+        if (_geometries[i] != nullptr)
+        {
+            Drop(_geometries[i]);
+            _geometries[i] = nullptr;
+        }
+    }
+    _next = 0;
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,85 @@
+#ifndef STROKEGEOMETRYCACHE_H
+#define STROKEGEOMETRYCACHE_H
+
+#include "InkCanvas_global.h"
+#include "Windows/Ink/stylustip.h"
+#include "Windows/Ink/drawingflags.h"
+#include "Windows/Media/matrix.h"
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+class DrawingAttributes;
+class Geometry;
+
+/// <summary>
+/// The part of a DrawingAttributes that decides the outline of a stroke:
+/// width, height, tip, tip transform and drawing flags (FitToCurve / IgnorePressure).
+/// Two keys compare equal exactly when DrawingAttributes::GeometricallyEqual would.
+/// </summary>
+class StrokeGeometryKey
+{
+public:
+    StrokeGeometryKey();
+
+    StrokeGeometryKey(DrawingAttributes const & drawingAttributes);
+
+    bool Matches(DrawingAttributes const & drawingAttributes) const;
+
+private:
+    StylusTip _stylusTip = StylusTip::Ellipse;
+    Matrix _stylusTipTransform;
+    double _width = 0;
+    double _height = 0;
+    DrawingFlags _drawingFlags = DrawingFlag::Polyline;
+};
+
+/// <summary>
+/// A small per-stroke cache of geometries built for DrawingAttributes that are
+/// geometrically different from the stroke's own, like the outer and inner
+/// passes used to draw a selected stroke as hollow.
+/// The geometries only depend on the stylus points and the key, so the cache
+/// only has to be cleared when the points change.
+/// </summary>
+class StrokeGeometryCache
+{
+public:
+    /// <summary>
+    /// Two entries for hollow rendering, plus some slack for high contrast
+    /// or custom DrawCore overrides
+    /// </summary>
+    static constexpr int Capacity = 4;
+
+    StrokeGeometryCache(void * owner);
+
+    ~StrokeGeometryCache();
+
+    /// <summary>
+    /// Returns the geometry cached for drawingAttributes, or nullptr
+    /// </summary>
+    Geometry * Find(DrawingAttributes const & drawingAttributes);
+
+    /// <summary>
+    /// Caches geometry for drawingAttributes. The cache takes ownership,
+    /// evicting the least recently added entry when full.
+    /// </summary>
+    void Add(DrawingAttributes const & drawingAttributes, Geometry * geometry);
+
+    /// <summary>
+    /// Drops all cached geometries, those still shown by drawings are left to them
+    /// </summary>
+    void Clear();
+
+private:
+    void Drop(Geometry * geometry);
+
+private:
+    void * _owner;
+    int _next = 0;
+    StrokeGeometryKey _keys[Capacity];
+    Geometry * _geometries[Capacity] = { nullptr };
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // STROKEGEOMETRYCACHE_H
@@ -94,7 +94,7 @@ void StrokeNode::GetPointsAtStartOfSegment(List<Point> & abPoints,
                 debugDC.DrawRectangle(QBrush(), QPen(Qt::pink , feedbackSize / 2), _operations->GetNodeBounds(_lastNode));
             }
 #endif
-            Array<Vector> vertices = _operations->GetVertices();
+            Array<Vector> const & vertices = _operations->GetVertices();
             double pressureFactor = _lastNode.PressureFactor();
             int maxCount = vertices.Length() * 2;
             int i = 0;
@@ -215,7 +215,7 @@ void StrokeNode::GetPointsAtEndOfSegment(  List<Point> &abPoints,
             //we're interested in the B, C points as well as the
             //nodecountour points between them
             double pressureFactor = _thisNode.PressureFactor();
-            Array<Vector> vertices = _operations->GetVertices();
+            Array<Vector> const & vertices = _operations->GetVertices();
             int maxCount = vertices.Length() * 2;
             int i = 0;
             for (; i < maxCount; i++)
@@ -480,7 +480,7 @@ void StrokeNode::GetPointsAtMiddleSegment( StrokeNode & previous,
                     int indexC = -1;
                     int indexD = -1;
 
-                    Array<Vector> vertices = _operations->GetVertices();
+                    Array<Vector> const & vertices = _operations->GetVertices();
                     double pressureFactor = _lastNode.PressureFactor();
                     for (int i = 0; i < vertices.Length(); i++)
                     {
@@ -718,11 +718,22 @@ bool StrokeNode::HitTest(StrokeNode const & hitNode)
         return false;
     }
 
-    List<ContourSegment> hittingContour = hitNode.GetContourSegments();
+    ContourSegmentBuffer hittingContour;
+    hitNode.GetContourSegments(hittingContour);
 
     return _operations->HitTest(_lastNode, _thisNode, ConnectingQuad(), hittingContour);
 }
 
+bool StrokeNode::HitTest(ContourSegmentBuffer const & hitContour)
+{
+    if (!IsValid())
+    {
+        return false;
+    }
+
+    return _operations->HitTest(_lastNode, _thisNode, ConnectingQuad(), hitContour);
+}
+
 /// <summary>
 /// Finds out if a given node intersects with this one,
 /// and returns findices of the intersection.
@@ -736,11 +747,22 @@ StrokeFIndices StrokeNode::CutTest(StrokeNode const & hitNode)
         return StrokeFIndices::Empty();
     }
 
-    List<ContourSegment> hittingContour = hitNode.GetContourSegments();
+    ContourSegmentBuffer hittingContour;
+    hitNode.GetContourSegments(hittingContour);
+
+    return CutTest(hittingContour);
+}
+
+StrokeFIndices StrokeNode::CutTest(ContourSegmentBuffer const & hitContour)
+{
+    if (IsValid() == false)
+    {
+        return StrokeFIndices::Empty();
+    }
 
     // If the node contours intersect, the result is a pair of findices
     // this segment should be cut at to let the hitNode's contour through it.
-    StrokeFIndices cutAt = _operations->CutTest(_lastNode, _thisNode, ConnectingQuad(), hittingContour);
+    StrokeFIndices cutAt = _operations->CutTest(_lastNode, _thisNode, ConnectingQuad(), hitContour);
 
     return (_index == 0) ? cutAt : BindFIndices(cutAt);
 }
@@ -868,7 +890,7 @@ Quad const & StrokeNode::ConnectingQuad() const
 /// and connecting quadrangle (_lastNode is excluded)
 /// Used for hit-testing a stroke against an other stroke (stroke and point erasing)
 /// </summary>
-List<ContourSegment> StrokeNode::GetContourSegments() const
+void StrokeNode::GetContourSegments(ContourSegmentBuffer & result) const
 {
     Debug::Assert(IsValid());
 
@@ -876,9 +898,10 @@ List<ContourSegment> StrokeNode::GetContourSegments() const
     if (IsEllipse())
     {
         // ISSUE-2004/06/15- temporary workaround to avoid hit-testing with ellipses
-        return _operations->GetNonBezierContourSegments(_lastNode, _thisNode);
+        _operations->GetNonBezierContourSegments(_lastNode, _thisNode, result);
+        return;
     }
-    return  _operations->GetContourSegments(_thisNode, ConnectingQuad());
+    _operations->GetContourSegments(_thisNode, ConnectingQuad(), result);
 }
 
 /// <summary>
@@ -9,7 +9,6 @@
 
 INKCANVAS_BEGIN_NAMESPACE
 
-class ContourSegment;
 class StrokeRenderer;
 class DrawingContext;
 
@@ -130,6 +129,16 @@ public:
         return Quad::Empty();
     }
 
+    /// <summary>
+    /// Sets the connecting quad when it is computed ahead for a run of nodes,
+    /// see StrokeNodeOperations::GetConnectingQuads
+    /// </summary>
+    void SetConnectingQuad(Quad const & quad)
+    {
+        _connectingQuad = quad;
+        _isQuadCached = true;
+    }
+
     ///// <summary>
     ///// IsPointWithinRectOrEllipse
     ///// </summary>
@@ -221,6 +230,12 @@ public:
     /// <returns></returns>
     bool HitTest(StrokeNode const & hitNode);
 
+    /// <summary>
+    /// Same as HitTest(hitNode), with the contour of the hitting node
+    /// already built by hitNode.GetContourSegments()
+    /// </summary>
+    bool HitTest(ContourSegmentBuffer const & hitContour);
+
     /// <summary>
     /// Finds out if a given node intersects with this one,
     /// and returns findices of the intersection.
@@ -229,6 +244,12 @@ public:
     /// <returns></returns>
     StrokeFIndices CutTest(StrokeNode const & hitNode);
 
+    /// <summary>
+    /// Same as CutTest(hitNode), with the contour of the hitting node
+    /// already built, so that it can be shared by all nodes cut-tested against it
+    /// </summary>
+    StrokeFIndices CutTest(ContourSegmentBuffer const & hitContour);
+
     /// <summary>
     /// Finds out if a given linear segment intersects with the contour of this node
     /// (including connecting quadrangle), and returns findices of the intersection.
@@ -277,7 +298,8 @@ public:
     /// and connecting quadrangle (_lastNode is excluded)
     /// Used for hit-testing a stroke against an other stroke (stroke and point erasing)
     /// </summary>
-    List<ContourSegment> GetContourSegments() const;
+    /// <param name="result">receives the edges, cleared first</param>
+    void GetContourSegments(ContourSegmentBuffer & result) const;
 
     /// <summary>
     /// Returns the spine point that corresponds to the given findex.
@@ -0,0 +1,243 @@
+#include "Internal/Ink/strokenodebatch.h"
+#include "Internal/Ink/strokenodebatchkernels.h"
+#include "Internal/Ink/quad.h"
+#include "Windows/rect.h"
+
+#include <atomic>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INKCANVAS_NODEBATCH_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if INKCANVAS_NODEBATCH_AVX && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+INKCANVAS_BEGIN_NAMESPACE
+
+#if INKCANVAS_NODEBATCH_SSE2
+
+namespace {
+
+struct Sse2Pack
+{
+    static constexpr int Width = 2;
+    typedef __m128d Mask;
+
+    __m128d v;
+
+    static Sse2Pack Load(double const * p) { return {_mm_loadu_pd(p)}; }
+    static Sse2Pack Set(double d) { return {_mm_set1_pd(d)}; }
+    void Store(double * p) const { _mm_storeu_pd(p, v); }
+    static void StoreMask(Mask m, double * p) { _mm_storeu_pd(p, _mm_and_pd(m, _mm_set1_pd(1.0))); }
+
+    friend Sse2Pack operator+(Sse2Pack a, Sse2Pack b) { return {_mm_add_pd(a.v, b.v)}; }
+    friend Sse2Pack operator-(Sse2Pack a, Sse2Pack b) { return {_mm_sub_pd(a.v, b.v)}; }
+    friend Sse2Pack operator*(Sse2Pack a, Sse2Pack b) { return {_mm_mul_pd(a.v, b.v)}; }
+    friend Sse2Pack operator/(Sse2Pack a, Sse2Pack b) { return {_mm_div_pd(a.v, b.v)}; }
+    friend Sse2Pack operator-(Sse2Pack a) { return {_mm_xor_pd(a.v, _mm_set1_pd(-0.0))}; }
+    friend Sse2Pack Sqrt(Sse2Pack a) { return {_mm_sqrt_pd(a.v)}; }
+    friend Sse2Pack Abs(Sse2Pack a) { return {_mm_andnot_pd(_mm_set1_pd(-0.0), a.v)}; }
+    friend Sse2Pack Min(Sse2Pack a, Sse2Pack b) { return {_mm_min_pd(a.v, b.v)}; }
+    friend Sse2Pack Max(Sse2Pack a, Sse2Pack b) { return {_mm_max_pd(a.v, b.v)}; }
+    friend Mask Lt(Sse2Pack a, Sse2Pack b) { return _mm_cmplt_pd(a.v, b.v); }
+    friend Mask Eq(Sse2Pack a, Sse2Pack b) { return _mm_cmpeq_pd(a.v, b.v); }
+    static Mask And(Mask a, Mask b) { return _mm_and_pd(a, b); }
+    static Mask Or(Mask a, Mask b) { return _mm_or_pd(a, b); }
+    friend Sse2Pack Select(Mask m, Sse2Pack a, Sse2Pack b) { return {_mm_or_pd(_mm_and_pd(m, a.v), _mm_andnot_pd(m, b.v))}; }
+};
+
+} // namespace
+
+#endif
+
+static StrokeNodeBatch::Kernel DetectKernel()
+{
+#if INKCANVAS_NODEBATCH_AVX
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    // AVX and OSXSAVE, then the OS saves the YMM state
+    if ((info[2] & (1 << 28)) && (info[2] & (1 << 27)) && (_xgetbv(0) & 6) == 6)
+        return StrokeNodeBatch::AVX;
+#else
+    if (__builtin_cpu_supports("avx"))
+        return StrokeNodeBatch::AVX;
+#endif
+#endif
+#if INKCANVAS_NODEBATCH_SSE2
+    return StrokeNodeBatch::SSE2;
+#else
+    return StrokeNodeBatch::Scalar;
+#endif
+}
+
+static std::atomic<int> s_activeKernel(-1);
+
+StrokeNodeBatch::Kernel StrokeNodeBatch::SupportedKernel()
+{
+    static Kernel const supported = DetectKernel();
+    return supported;
+}
+
+StrokeNodeBatch::Kernel StrokeNodeBatch::ActiveKernel()
+{
+    int kernel = s_activeKernel.load(std::memory_order_relaxed);
+    if (kernel < 0)
+    {
+        kernel = SupportedKernel();
+        s_activeKernel.store(kernel, std::memory_order_relaxed);
+    }
+    return static_cast<Kernel>(kernel);
+}
+
+void StrokeNodeBatch::SetActiveKernel(Kernel kernel)
+{
+    if (kernel > SupportedKernel())
+        kernel = SupportedKernel();
+    s_activeKernel.store(kernel, std::memory_order_relaxed);
+}
+
+void StrokeNodeBatch::GetNodeBounds(Rect const & shapeBounds, double const * x, double const * y,
+                                    double const * pressureFactor, int count, Rect * bounds)
+{
+    double const shape[4] = {shapeBounds.X(), shapeBounds.Y(), shapeBounds.Width(), shapeBounds.Height()};
+    double left[RunLength], top[RunLength], width[RunLength], height[RunLength];
+    Kernel kernel = ActiveKernel();
+    for (int start = 0; start < count; start += RunLength)
+    {
+        int n = count - start < RunLength ? count - start : RunLength;
+        double const * rx = x + start;
+        double const * ry = y + start;
+        double const * rp = pressureFactor + start;
+        switch (kernel)
+        {
+#if INKCANVAS_NODEBATCH_AVX
+        case AVX:
+            StrokeNodeBoundsAvx(shape, rx, ry, rp, n, left, top, width, height);
+            break;
+#endif
+#if INKCANVAS_NODEBATCH_SSE2
+        case SSE2:
+            NodeBoundsKernel<Sse2Pack>(shape, rx, ry, rp, 0, n, left, top, width, height);
+            break;
+#endif
+        default:
+            NodeBoundsKernel<ScalarPack>(shape, rx, ry, rp, 0, n, left, top, width, height);
+            break;
+        }
+        for (int i = 0; i < n; i++)
+        {
+            bounds[start + i] = Rect(left[i], top[i], width[i], height[i]);
+        }
+    }
+}
+
+void StrokeNodeBatch::UnionNodeBounds(Rect const & shapeBounds, double const * x, double const * y,
+                                      double const * pressureFactor, int count, double * extents)
+{
+    if (count <= 0)
+        return;
+
+    double const shape[4] = {shapeBounds.X(), shapeBounds.Y(), shapeBounds.Width(), shapeBounds.Height()};
+    double points[6] = {x[0], y[0], x[0], y[0], pressureFactor[0], pressureFactor[0]};
+    Kernel kernel = ActiveKernel();
+    switch (kernel)
+    {
+#if INKCANVAS_NODEBATCH_AVX
+    case AVX:
+        StrokePointExtentsAvx(x, y, pressureFactor, count, points);
+        break;
+#endif
+#if INKCANVAS_NODEBATCH_SSE2
+    case SSE2:
+        PointExtentsKernel<Sse2Pack>(x, y, pressureFactor, 0, count, points);
+        break;
+#endif
+    default:
+        PointExtentsKernel<ScalarPack>(x, y, pressureFactor, 0, count, points);
+        break;
+    }
+
+    if (points[4] == points[5])
+    {
+        // One pressure factor, the node edges grow with the positions
+        double pf = points[4];
+        bool unscaled = KernelAreClose(ScalarPack::Set(pf), ScalarPack::Set(1.0));
+        double sx = unscaled ? shape[0] : shape[0] * pf;
+        double sy = unscaled ? shape[1] : shape[1] * pf;
+        double sw = unscaled ? shape[2] : shape[2] * pf;
+        double sh = unscaled ? shape[3] : shape[3] * pf;
+        double nodes[4] = {sx + points[0], sy + points[1], (sx + points[2]) + sw, (sy + points[3]) + sh};
+        extents[0] = nodes[0] < extents[0] ? nodes[0] : extents[0];
+        extents[1] = nodes[1] < extents[1] ? nodes[1] : extents[1];
+        extents[2] = nodes[2] > extents[2] ? nodes[2] : extents[2];
+        extents[3] = nodes[3] > extents[3] ? nodes[3] : extents[3];
+        return;
+    }
+
+    switch (kernel)
+    {
+#if INKCANVAS_NODEBATCH_AVX
+    case AVX:
+        StrokeNodeExtentsAvx(shape, x, y, pressureFactor, count, extents);
+        break;
+#endif
+#if INKCANVAS_NODEBATCH_SSE2
+    case SSE2:
+        NodeExtentsKernel<Sse2Pack>(shape, x, y, pressureFactor, 0, count, extents);
+        break;
+#endif
+    default:
+        NodeExtentsKernel<ScalarPack>(shape, x, y, pressureFactor, 0, count, extents);
+        break;
+    }
+}
+
+void StrokeNodeBatch::GetCircleConnectingQuads(double radius, double const * x, double const * y,
+                                               double const * pressureFactor, int count, Quad * quads)
+{
+    double corners[8][RunLength];
+    double empty[RunLength];
+    StrokeNodeQuadRun run;
+    for (int c = 0; c < 8; c++)
+    {
+        run.corners[c] = corners[c];
+    }
+    run.empty = empty;
+    Kernel kernel = ActiveKernel();
+    // Runs overlap by one node, the begin node of their first pair
+    for (int start = 0; start + 1 < count; start += RunLength - 1)
+    {
+        int n = count - start < RunLength ? count - start : RunLength;
+        double const * rx = x + start;
+        double const * ry = y + start;
+        double const * rp = pressureFactor + start;
+        switch (kernel)
+        {
+#if INKCANVAS_NODEBATCH_AVX
+        case AVX:
+            StrokeNodeCircleQuadsAvx(radius, rx, ry, rp, n, run);
+            break;
+#endif
+#if INKCANVAS_NODEBATCH_SSE2
+        case SSE2:
+            CircleQuadsKernel<Sse2Pack>(radius, rx, ry, rp, 1, n, run);
+            break;
+#endif
+        default:
+            CircleQuadsKernel<ScalarPack>(radius, rx, ry, rp, 1, n, run);
+            break;
+        }
+        for (int i = 1; i < n; i++)
+        {
+            quads[start + i] = empty[i] != 0
+                ? Quad::Empty()
+                : Quad(Point(corners[0][i], corners[1][i]), Point(corners[2][i], corners[3][i]),
+                       Point(corners[4][i], corners[5][i]), Point(corners[6][i], corners[7][i]));
+        }
+    }
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,75 @@
+#ifndef STROKENODEBATCH_H
+#define STROKENODEBATCH_H
+
+#include "InkCanvas_global.h"
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+class Rect;
+class Quad;
+
+/// <summary>
+/// Node geometry for a contiguous run of stroke nodes at once. Nodes are
+/// passed as separate x, y and pressure factor arrays (see
+/// StrokeNodeIterator::GetNodeRun) and processed several per instruction
+/// with SSE2 or AVX, whichever the processor supports, or one by one with
+/// the scalar kernel elsewhere. All kernels give the same results as
+/// StrokeNodeOperations::GetNodeBounds and GetConnectingQuad on each node.
+/// </summary>
+class StrokeNodeBatch
+{
+public:
+    enum Kernel
+    {
+        Scalar,
+        SSE2,
+        AVX,
+    };
+
+    /// <summary>
+    /// Nodes gathered per run by the callers, sizes their stack buffers
+    /// </summary>
+    static constexpr int RunLength = 64;
+
+    /// <summary>
+    /// The best kernel this build and processor support
+    /// </summary>
+    static Kernel SupportedKernel();
+
+    static Kernel ActiveKernel();
+
+    /// <summary>
+    /// Selects a kernel, limited to SupportedKernel(), for testing and
+    /// benchmarking the kernels against each other
+    /// </summary>
+    static void SetActiveKernel(Kernel kernel);
+
+    /// <summary>
+    /// Bounds of count nodes of a shape with shapeBounds (at pressure factor 1)
+    /// </summary>
+    static void GetNodeBounds(Rect const & shapeBounds, double const * x, double const * y,
+                              double const * pressureFactor, int count, Rect * bounds);
+
+    /// <summary>
+    /// Extends extents, left, top, right and bottom, by the bounds of count
+    /// nodes, the same edges GetNodeBounds gives each node. The positions and
+    /// pressure factors are reduced first; the node edges follow from those
+    /// when all nodes have the same pressure factor, so only nodes of varying
+    /// pressure are gone over a second time.
+    /// </summary>
+    static void UnionNodeBounds(Rect const & shapeBounds, double const * x, double const * y,
+                                double const * pressureFactor, int count, double * extents);
+
+    /// <summary>
+    /// Quads connecting each node of a run to the node before it, for an
+    /// elliptical tip that is a circle of radius without transform.
+    /// quads[0] has no node before it and is left untouched.
+    /// </summary>
+    static void GetCircleConnectingQuads(double radius, double const * x, double const * y,
+                                         double const * pressureFactor, int count, Quad * quads);
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // STROKENODEBATCH_H
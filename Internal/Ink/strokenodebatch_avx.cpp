@@ -0,0 +1,71 @@
+// Compiled with AVX code generation (AVX_SOURCES), only called after
+//  StrokeNodeBatch::SupportedKernel() has found AVX. Keep the includes to
+//  the kernels: any inline function of other headers instantiated here
+//  could be picked by the linker for the whole program.
+#include "Internal/Ink/strokenodebatchkernels.h"
+
+#include <immintrin.h>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+namespace {
+
+struct AvxPack
+{
+    static constexpr int Width = 4;
+    typedef __m256d Mask;
+
+    __m256d v;
+
+    static AvxPack Load(double const * p) { return {_mm256_loadu_pd(p)}; }
+    static AvxPack Set(double d) { return {_mm256_set1_pd(d)}; }
+    void Store(double * p) const { _mm256_storeu_pd(p, v); }
+    static void StoreMask(Mask m, double * p) { _mm256_storeu_pd(p, _mm256_and_pd(m, _mm256_set1_pd(1.0))); }
+
+    friend AvxPack operator+(AvxPack a, AvxPack b) { return {_mm256_add_pd(a.v, b.v)}; }
+    friend AvxPack operator-(AvxPack a, AvxPack b) { return {_mm256_sub_pd(a.v, b.v)}; }
+    friend AvxPack operator*(AvxPack a, AvxPack b) { return {_mm256_mul_pd(a.v, b.v)}; }
+    friend AvxPack operator/(AvxPack a, AvxPack b) { return {_mm256_div_pd(a.v, b.v)}; }
+    friend AvxPack operator-(AvxPack a) { return {_mm256_xor_pd(a.v, _mm256_set1_pd(-0.0))}; }
+    friend AvxPack Sqrt(AvxPack a) { return {_mm256_sqrt_pd(a.v)}; }
+    friend AvxPack Abs(AvxPack a) { return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v)}; }
+    friend AvxPack Min(AvxPack a, AvxPack b) { return {_mm256_min_pd(a.v, b.v)}; }
+    friend AvxPack Max(AvxPack a, AvxPack b) { return {_mm256_max_pd(a.v, b.v)}; }
+    friend Mask Lt(AvxPack a, AvxPack b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+    friend Mask Eq(AvxPack a, AvxPack b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+    static Mask And(Mask a, Mask b) { return _mm256_and_pd(a, b); }
+    static Mask Or(Mask a, Mask b) { return _mm256_or_pd(a, b); }
+    friend AvxPack Select(Mask m, AvxPack a, AvxPack b) { return {_mm256_blendv_pd(b.v, a.v, m)}; }
+};
+
+} // namespace
+
+void StrokeNodeBoundsAvx(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                         int count, double * left, double * top, double * width, double * height)
+{
+    NodeBoundsKernel<AvxPack>(shape, x, y, pressureFactor, 0, count, left, top, width, height);
+    _mm256_zeroupper();
+}
+
+void StrokeNodeCircleQuadsAvx(double radius, double const * x, double const * y, double const * pressureFactor,
+                              int count, StrokeNodeQuadRun const & quads)
+{
+    CircleQuadsKernel<AvxPack>(radius, x, y, pressureFactor, 1, count, quads);
+    _mm256_zeroupper();
+}
+
+void StrokePointExtentsAvx(double const * x, double const * y, double const * pressureFactor,
+                           int count, double * extents)
+{
+    PointExtentsKernel<AvxPack>(x, y, pressureFactor, 0, count, extents);
+    _mm256_zeroupper();
+}
+
+void StrokeNodeExtentsAvx(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                          int count, double * extents)
+{
+    NodeExtentsKernel<AvxPack>(shape, x, y, pressureFactor, 0, count, extents);
+    _mm256_zeroupper();
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,267 @@
+#ifndef STROKENODEBATCHKERNELS_H
+#define STROKENODEBATCHKERNELS_H
+
+#include "InkCanvas_global.h"
+
+#include <cmath>
+
+// Kernels of StrokeNodeBatch, written once against a small "pack" interface
+//  and instantiated for plain doubles, SSE2 and AVX. This header is included
+//  by translation units compiled with different instruction sets, so it must
+//  only contain templates in an anonymous namespace and no non-template
+//  inline functions: the linker would be free to pick the AVX build of those
+//  for the whole program.
+//
+// The kernels repeat the arithmetic of StrokeNodeOperations::GetNodeBounds
+//  and EllipticalNodeOperations::GetConnectingQuad operation by operation,
+//  including the DoubleUtil fuzzy compares, so all kernels produce the same
+//  bits as the per-node code.
+
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// Quad corners of a run as separate arrays, A.x A.y B.x B.y C.x C.y D.x D.y,
+/// with empty[i] != 0 where the quad is empty
+/// </summary>
+struct StrokeNodeQuadRun
+{
+    double * corners[8];
+    double * empty;
+};
+
+// Entry points of strokenodebatch_avx.cpp
+void StrokeNodeBoundsAvx(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                         int count, double * left, double * top, double * width, double * height);
+void StrokeNodeCircleQuadsAvx(double radius, double const * x, double const * y, double const * pressureFactor,
+                              int count, StrokeNodeQuadRun const & quads);
+void StrokePointExtentsAvx(double const * x, double const * y, double const * pressureFactor,
+                           int count, double * extents);
+void StrokeNodeExtentsAvx(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                          int count, double * extents);
+
+namespace {
+
+// Same as DoubleUtil::DBL_EPSILON
+constexpr double KernelEpsilon = 2.2204460492503131e-016;
+
+/// <summary>
+/// One lane, the scalar kernel and the tail of the SIMD ones
+/// </summary>
+struct ScalarPack
+{
+    static constexpr int Width = 1;
+    typedef bool Mask;
+
+    double v;
+
+    static ScalarPack Load(double const * p) { return {*p}; }
+    static ScalarPack Set(double d) { return {d}; }
+    void Store(double * p) const { *p = v; }
+    static void StoreMask(Mask m, double * p) { *p = m ? 1 : 0; }
+
+    friend ScalarPack operator+(ScalarPack a, ScalarPack b) { return {a.v + b.v}; }
+    friend ScalarPack operator-(ScalarPack a, ScalarPack b) { return {a.v - b.v}; }
+    friend ScalarPack operator*(ScalarPack a, ScalarPack b) { return {a.v * b.v}; }
+    friend ScalarPack operator/(ScalarPack a, ScalarPack b) { return {a.v / b.v}; }
+    friend ScalarPack operator-(ScalarPack a) { return {-a.v}; }
+    friend ScalarPack Sqrt(ScalarPack a) { return {std::sqrt(a.v)}; }
+    friend ScalarPack Abs(ScalarPack a) { return {std::fabs(a.v)}; }
+    friend ScalarPack Min(ScalarPack a, ScalarPack b) { return {a.v < b.v ? a.v : b.v}; }
+    friend ScalarPack Max(ScalarPack a, ScalarPack b) { return {a.v > b.v ? a.v : b.v}; }
+    friend Mask Lt(ScalarPack a, ScalarPack b) { return a.v < b.v; }
+    friend Mask Eq(ScalarPack a, ScalarPack b) { return a.v == b.v; }
+    static Mask And(Mask a, Mask b) { return a && b; }
+    static Mask Or(Mask a, Mask b) { return a || b; }
+    friend ScalarPack Select(Mask m, ScalarPack a, ScalarPack b) { return m ? a : b; }
+};
+
+template<typename P>
+typename P::Mask KernelAreClose(P a, P b)
+{
+    P eps = (Abs(a) + Abs(b) + P::Set(10.0)) * P::Set(KernelEpsilon);
+    P delta = a - b;
+    return P::Or(Eq(a, b), P::And(Lt(-eps, delta), Lt(delta, eps)));
+}
+
+template<typename P>
+typename P::Mask KernelIsZero(P a)
+{
+    return Lt(Abs(a), P::Set(10.0 * KernelEpsilon));
+}
+
+/// <summary>
+/// StrokeNodeOperations::GetNodeBounds for nodes [begin, end), shape is
+/// the node shape bounds x, y, width, height
+/// </summary>
+template<typename P>
+void NodeBoundsKernel(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                      int begin, int end, double * left, double * top, double * width, double * height)
+{
+    P sx = P::Set(shape[0]), sy = P::Set(shape[1]), sw = P::Set(shape[2]), sh = P::Set(shape[3]);
+    P one = P::Set(1.0);
+    int i = begin;
+    for (; i + P::Width <= end; i += P::Width)
+    {
+        P pf = P::Load(pressureFactor + i);
+        typename P::Mask unscaled = KernelAreClose(pf, one);
+        (Select(unscaled, sx, sx * pf) + P::Load(x + i)).Store(left + i);
+        (Select(unscaled, sy, sy * pf) + P::Load(y + i)).Store(top + i);
+        Select(unscaled, sw, sw * pf).Store(width + i);
+        Select(unscaled, sh, sh * pf).Store(height + i);
+    }
+    if (P::Width > 1)
+        NodeBoundsKernel<ScalarPack>(shape, x, y, pressureFactor, i, end, left, top, width, height);
+}
+
+/// <summary>
+/// Folds the lanes of min and max into extents[minIndex] and extents[maxIndex]
+/// </summary>
+template<typename P>
+void ReduceExtents(P min, P max, double * extents, int minIndex, int maxIndex)
+{
+    double lanes[P::Width];
+    min.Store(lanes);
+    for (int l = 0; l < P::Width; l++)
+    {
+        extents[minIndex] = lanes[l] < extents[minIndex] ? lanes[l] : extents[minIndex];
+    }
+    max.Store(lanes);
+    for (int l = 0; l < P::Width; l++)
+    {
+        extents[maxIndex] = lanes[l] > extents[maxIndex] ? lanes[l] : extents[maxIndex];
+    }
+}
+
+/// <summary>
+/// Extends extents, min x, min y, max x, max y, min and max pressure factor,
+/// by the nodes [begin, end)
+/// </summary>
+template<typename P>
+void PointExtentsKernel(double const * x, double const * y, double const * pressureFactor,
+                        int begin, int end, double * extents)
+{
+    P minX = P::Set(extents[0]), minY = P::Set(extents[1]), maxX = P::Set(extents[2]), maxY = P::Set(extents[3]);
+    P minPf = P::Set(extents[4]), maxPf = P::Set(extents[5]);
+    int i = begin;
+    for (; i + P::Width <= end; i += P::Width)
+    {
+        P px = P::Load(x + i), py = P::Load(y + i), pf = P::Load(pressureFactor + i);
+        minX = Min(minX, px);
+        maxX = Max(maxX, px);
+        minY = Min(minY, py);
+        maxY = Max(maxY, py);
+        minPf = Min(minPf, pf);
+        maxPf = Max(maxPf, pf);
+    }
+    ReduceExtents(minX, maxX, extents, 0, 2);
+    ReduceExtents(minY, maxY, extents, 1, 3);
+    ReduceExtents(minPf, maxPf, extents, 4, 5);
+    if (P::Width > 1)
+        PointExtentsKernel<ScalarPack>(x, y, pressureFactor, i, end, extents);
+}
+
+/// <summary>
+/// Extends extents, left, top, right and bottom, by the bounds of the nodes
+/// [begin, end) as NodeBoundsKernel computes them
+/// </summary>
+template<typename P>
+void NodeExtentsKernel(double const * shape, double const * x, double const * y, double const * pressureFactor,
+                       int begin, int end, double * extents)
+{
+    P sx = P::Set(shape[0]), sy = P::Set(shape[1]), sw = P::Set(shape[2]), sh = P::Set(shape[3]);
+    P one = P::Set(1.0);
+    P left = P::Set(extents[0]), top = P::Set(extents[1]), right = P::Set(extents[2]), bottom = P::Set(extents[3]);
+    int i = begin;
+    for (; i + P::Width <= end; i += P::Width)
+    {
+        P pf = P::Load(pressureFactor + i);
+        typename P::Mask unscaled = KernelAreClose(pf, one);
+        P l = Select(unscaled, sx, sx * pf) + P::Load(x + i);
+        P t = Select(unscaled, sy, sy * pf) + P::Load(y + i);
+        left = Min(left, l);
+        top = Min(top, t);
+        right = Max(right, l + Select(unscaled, sw, sw * pf));
+        bottom = Max(bottom, t + Select(unscaled, sh, sh * pf));
+    }
+    ReduceExtents(left, right, extents, 0, 2);
+    ReduceExtents(top, bottom, extents, 1, 3);
+    if (P::Width > 1)
+        NodeExtentsKernel<ScalarPack>(shape, x, y, pressureFactor, i, end, extents);
+}
+
+/// <summary>
+/// EllipticalNodeOperations::GetConnectingQuad for a circular tip without
+/// transform, for the node pairs (i - 1, i), i in [begin, end), begin >= 1
+/// </summary>
+template<typename P>
+void CircleQuadsKernel(double radius, double const * x, double const * y, double const * pressureFactor,
+                       int begin, int end, StrokeNodeQuadRun const & quads)
+{
+    P r = P::Set(radius);
+    P zero = P::Set(0.0);
+    P one = P::Set(1.0);
+    int i = begin;
+    for (; i + P::Width <= end; i += P::Width)
+    {
+        P bx = P::Load(x + i - 1), by = P::Load(y + i - 1), bp = P::Load(pressureFactor + i - 1);
+        P ex = P::Load(x + i), ey = P::Load(y + i), ep = P::Load(pressureFactor + i);
+
+        // StrokeNodeData::IsEmpty and coinciding nodes
+        typename P::Mask empty = P::Or(P::Or(KernelAreClose(bp, zero), KernelAreClose(ep, zero)),
+                                    P::And(KernelAreClose(bx, ex), KernelAreClose(by, ey)));
+
+        P spineX = ex - bx;
+        P spineY = ey - by;
+        P beginRadius = r * bp;
+        P endRadius = r * ep;
+
+        P distanceSquared = spineX * spineX + spineY * spineY;
+        P delta = endRadius - beginRadius;
+        P deltaSquared = Select(KernelIsZero(delta), zero, delta * delta);
+
+        // One circle is contained within the other
+        empty = P::Or(empty, P::Or(Lt(distanceSquared, deltaSquared), KernelAreClose(distanceSquared, deltaSquared)));
+
+        P distance = Sqrt(distanceSquared);
+        spineX = spineX / distance;
+        spineY = spineY / distance;
+
+        // Turn left
+        P radX = spineY;
+        P radY = -spineX;
+
+        P rSinSquared = deltaSquared / distanceSquared;
+        typename P::Mask tangent = KernelIsZero(rSinSquared);
+
+        P cos = Sqrt(one - rSinSquared);
+        P sin = Sqrt(rSinSquared);
+        P scaledRadX = radX * cos, scaledRadY = radY * cos;
+        P sinX = spineX * sin, sinY = spineY * sin;
+        typename P::Mask growing = Lt(bp, ep);
+        sinX = Select(growing, -sinX, sinX);
+        sinY = Select(growing, -sinY, sinY);
+
+        P leftX = Select(tangent, radX, sinX + scaledRadX);
+        P leftY = Select(tangent, radY, sinY + scaledRadY);
+        P rightX = Select(tangent, -radX, sinX - scaledRadX);
+        P rightY = Select(tangent, -radY, sinY - scaledRadY);
+
+        Select(empty, zero, bx + leftX * beginRadius).Store(quads.corners[0] + i);
+        Select(empty, zero, by + leftY * beginRadius).Store(quads.corners[1] + i);
+        Select(empty, zero, ex + leftX * endRadius).Store(quads.corners[2] + i);
+        Select(empty, zero, ey + leftY * endRadius).Store(quads.corners[3] + i);
+        Select(empty, zero, ex + rightX * endRadius).Store(quads.corners[4] + i);
+        Select(empty, zero, ey + rightY * endRadius).Store(quads.corners[5] + i);
+        Select(empty, zero, bx + rightX * beginRadius).Store(quads.corners[6] + i);
+        Select(empty, zero, by + rightY * beginRadius).Store(quads.corners[7] + i);
+        P::StoreMask(empty, quads.empty + i);
+    }
+    if (P::Width > 1)
+        CircleQuadsKernel<ScalarPack>(radius, x, y, pressureFactor, i, end, quads);
+}
+
+} // namespace
+
+INKCANVAS_END_NAMESPACE
+
+#endif // STROKENODEBATCHKERNELS_H
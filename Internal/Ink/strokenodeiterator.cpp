@@ -1,6 +1,14 @@
 #include "Internal/Ink/strokenodeiterator.h"
 #include "Internal/Ink/strokenode.h"
+#include "Internal/Ink/strokenodebatch.h"
+#include "Windows/Ink/stylusshape.h"
 #include "Windows/Input/styluspoint.h"
+#include "Windows/Media/matrix.h"
+#include "Internal/debug.h"
+
+#include <algorithm>
+#include <climits>
+#include <limits>
 
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -18,11 +26,59 @@ StrokeNodeIterator StrokeNodeIterator::GetIterator(Stroke & stroke, DrawingAttri
     //    throw std::runtime_error("drawingAttributes");
     //}
 
+    // Node arrays built for the stroke's own drawing attributes are cached
+    //  on the stroke, with the (Bezier) points they were read from
+    bool ownAttributes = DrawingAttributes::GeometricallyEqual(drawingAttributes, *stroke.GetDrawingAttributes());
+    if (ownAttributes)
+    {
+        std::shared_ptr<StrokeNodeArrays> nodes = stroke.NodeArrays();
+        if (nodes != nullptr && nodes->Key().Matches(drawingAttributes))
+        {
+            StrokeNodeIterator iterator = GetIterator(nodes->StylusPoints(), drawingAttributes);
+            iterator._nodes = nodes;
+            return iterator;
+        }
+    }
+
     SharedPointer<StylusPointCollection> stylusPoints =
         drawingAttributes.FitToCurve() ? stroke.GetBezierStylusPoints() : stroke.StylusPoints();
 
+    if (ownAttributes)
+    {
+        return CacheNodes(stroke, stylusPoints);
+    }
     return GetIterator(stylusPoints, drawingAttributes);
 }
+
+/// <summary>
+/// Creates an enumerator for stylusPoints, the stroke's own points or
+/// its Bezier points, with the stroke's drawing attributes, and caches
+/// its node arrays on the stroke
+/// </summary>
+StrokeNodeIterator StrokeNodeIterator::CacheNodes(Stroke & stroke, SharedPointer<StylusPointCollection> stylusPoints)
+{
+    DrawingAttributes & drawingAttributes = *stroke.GetDrawingAttributes();
+    StrokeNodeIterator iterator = GetIterator(stylusPoints, drawingAttributes);
+    iterator.MaterializeNodes().SetKey(StrokeGeometryKey(drawingAttributes));
+    stroke.SetNodeArrays(iterator._nodes);
+    return iterator;
+}
+/// <summary>
+/// Creates an enumerator for the nodes of iterator with their positions
+/// transformed by transform, for drawingAttributes
+/// </summary>
+StrokeNodeIterator StrokeNodeIterator::GetTransformedIterator(StrokeNodeIterator const & iterator, Matrix const & transform,
+                                                              DrawingAttributes& drawingAttributes)
+{
+    std::unique_ptr<StrokeNodeOperations> operations(
+        StrokeNodeOperations::CreateInstance(*drawingAttributes.GetStylusShape()));
+
+    // the points only give the count, the nodes come from the arrays
+    StrokeNodeIterator transformed(iterator._stylusPoints, std::move(operations), iterator._usePressure);
+    transformed._nodes = std::make_shared<StrokeNodeArrays>(iterator, transform, *transformed._operations);
+    return transformed;
+}
+
 /// <summary>
 /// Creates a default enumerator for a given stroke
 /// If using the strokes drawing attributes, pass stroke.DrawingAttributes for the second
@@ -47,6 +103,34 @@ StrokeNodeIterator StrokeNodeIterator::GetIterator(SharedPointer<StylusPointColl
     return StrokeNodeIterator(stylusPoints, std::move(operations), usePressure);
 }
 
+/// <summary>
+/// Bounds of the nodes of stylusPoints with drawingAttributes
+/// </summary>
+Rect StrokeNodeIterator::GetBounds(StylusPointCollection const & stylusPoints, DrawingAttributes& drawingAttributes)
+{
+    int count = stylusPoints.Count();
+    if (count == 0)
+    {
+        return Rect::Empty();
+    }
+
+    Rect const & shapeBounds = drawingAttributes.GetStylusShape()->VerticesBounds();
+    bool usePressure = !drawingAttributes.IgnorePressure();
+
+    double const infinity = std::numeric_limits<double>::infinity();
+    double extents[4] = {infinity, infinity, -infinity, -infinity};
+    double x[StrokeNodeBatch::RunLength];
+    double y[StrokeNodeBatch::RunLength];
+    double pressureFactor[StrokeNodeBatch::RunLength];
+    for (int start = 0; start < count; start += StrokeNodeBatch::RunLength)
+    {
+        int n = std::min(count - start, StrokeNodeBatch::RunLength);
+        GetNodeRun(stylusPoints, usePressure, start, n, x, y, pressureFactor);
+        StrokeNodeBatch::UnionNodeBounds(shapeBounds, x, y, pressureFactor, n, extents);
+    }
+    return Rect(extents[0], extents[1], extents[2] - extents[0], extents[3] - extents[1]);
+}
+
 
 
 /// <summary>
@@ -175,6 +259,22 @@ StrokeNode StrokeNodeIterator::GetNode(int index, int previousIndex) const
         throw new std::runtime_error("");
     }
 
+    if (_nodes != nullptr)
+    {
+        StrokeNodeData nodeData = _nodes->NodeData(index);
+        StrokeNodeData lastNodeData = StrokeNodeData::Empty();
+        if (previousIndex != -1)
+        {
+            lastNodeData = _nodes->NodeData(previousIndex);
+        }
+        StrokeNode node(_operations.get(), previousIndex + 1, nodeData, lastNodeData, index == _stylusPoints->Count() - 1);
+        if (previousIndex != -1 && previousIndex == index - 1)
+        {
+            node.SetConnectingQuad(_nodes->ConnectingQuad(*_operations, index));
+        }
+        return node;
+    }
+
     StylusPoint stylusPoint = (*_stylusPoints)[index];
     StylusPoint previousStylusPoint = (previousIndex == -1 ? StylusPoint() : (*_stylusPoints)[previousIndex]);
     float pressureFactor = 1.0f;
@@ -196,4 +296,152 @@ StrokeNode StrokeNodeIterator::GetNode(int index, int previousIndex) const
     return StrokeNode(_operations.get(), previousIndex + 1, nodeData, lastNodeData, index == _stylusPoints->Count() - 1 /*Is this the last node?*/);
 }
 
+/// <summary>
+/// Bounds of the node at index
+/// </summary>
+Rect StrokeNodeIterator::GetNodeBounds(int index) const
+{
+    if (_nodes != nullptr)
+    {
+        return _nodes->Bounds(index);
+    }
+    return (*this)[index].GetBounds();
+}
+
+/// <summary>
+/// Switches the iterator to compact node arrays, built on first call
+/// </summary>
+StrokeNodeArrays & StrokeNodeIterator::MaterializeNodes() const
+{
+    if (_nodes == nullptr)
+    {
+        _nodes = std::make_shared<StrokeNodeArrays>(*this);
+    }
+    return *_nodes;
+}
+
+/// <summary>
+/// Gets positions and pressure factors of the nodes [start, start + count)
+/// </summary>
+void StrokeNodeIterator::GetNodeRun(int start, int count, double * x, double * y, double * pressureFactor) const
+{
+    if (_stylusPoints == nullptr || start < 0 || count < 0 || start + count > _stylusPoints->Count())
+    {
+        throw std::runtime_error("count");
+    }
+
+    GetNodeRun(*_stylusPoints, _usePressure, start, count, x, y, pressureFactor);
+}
+
+void StrokeNodeIterator::GetNodeRun(StylusPointCollection const & stylusPoints, bool usePressure,
+                                    int start, int count, double * x, double * y, double * pressureFactor)
+{
+    for (int i = 0; i < count; i++)
+    {
+        StylusPoint const & stylusPoint = stylusPoints[start + i];
+        x[i] = stylusPoint.X();
+        y[i] = stylusPoint.Y();
+        pressureFactor[i] = usePressure
+            ? StrokeNodeIterator::GetNormalizedPressureFactor(stylusPoint.PressureFactor())
+            : 1.0f;
+    }
+}
+
+/// <summary>
+/// Reads the nodes of iterator and computes their bounds
+/// </summary>
+StrokeNodeArrays::StrokeNodeArrays(StrokeNodeIterator const & iterator)
+    : _stylusPoints(iterator._stylusPoints)
+{
+    int count = iterator.Count();
+    _x.resize(static_cast<size_t>(count));
+    _y.resize(static_cast<size_t>(count));
+    _pressureFactor.resize(static_cast<size_t>(count));
+    _bounds.resize(static_cast<size_t>(count));
+    _quadRuns.assign(static_cast<size_t>((count + StrokeNodeBatch::RunLength - 1) / StrokeNodeBatch::RunLength), false);
+    if (count > 0)
+    {
+        iterator.GetNodeRun(0, count, _x.data(), _y.data(), _pressureFactor.data());
+        iterator.Operations().GetNodeBounds(_x.data(), _y.data(), _pressureFactor.data(), count, _bounds.data());
+    }
+}
+
+/// <summary>
+/// Reads the nodes of iterator with their positions transformed by
+/// transform, and computes their bounds with operations
+/// </summary>
+StrokeNodeArrays::StrokeNodeArrays(StrokeNodeIterator const & iterator, Matrix const & transform, StrokeNodeOperations & operations)
+    : _stylusPoints(iterator._stylusPoints)
+{
+    int count = iterator.Count();
+    if (iterator._nodes != nullptr)
+    {
+        _x = iterator._nodes->_x;
+        _y = iterator._nodes->_y;
+        _pressureFactor = iterator._nodes->_pressureFactor;
+    }
+    else
+    {
+        _x.resize(static_cast<size_t>(count));
+        _y.resize(static_cast<size_t>(count));
+        _pressureFactor.resize(static_cast<size_t>(count));
+        if (count > 0)
+        {
+            iterator.GetNodeRun(0, count, _x.data(), _y.data(), _pressureFactor.data());
+        }
+    }
+    _bounds.resize(static_cast<size_t>(count));
+    _quadRuns.assign(static_cast<size_t>((count + StrokeNodeBatch::RunLength - 1) / StrokeNodeBatch::RunLength), false);
+    if (count > 0)
+    {
+        transform.Transform(_x.data(), _y.data(), count);
+        operations.GetNodeBounds(_x.data(), _y.data(), _pressureFactor.data(), count, _bounds.data());
+    }
+}
+
+/// <summary>
+/// Position and pressure factor of the node at index
+/// </summary>
+StrokeNodeData StrokeNodeArrays::NodeData(int index) const
+{
+    size_t i = static_cast<size_t>(index);
+    return StrokeNodeData(Point(_x[i], _y[i]), static_cast<float>(_pressureFactor[i]));
+}
+
+/// <summary>
+/// Memory held by the arrays, the quads counted in full before they are built
+/// </summary>
+size_t StrokeNodeArrays::ByteSize() const
+{
+    return sizeof(StrokeNodeArrays)
+        + (_x.capacity() + _y.capacity() + _pressureFactor.capacity()) * sizeof(double)
+        + _bounds.capacity() * sizeof(Rect)
+        + std::max(_quads.capacity(), _bounds.size()) * sizeof(Quad)
+        + _quadRuns.capacity() / CHAR_BIT;
+}
+
+/// <summary>
+/// The quad connecting the node at index to the node before it
+/// </summary>
+Quad const & StrokeNodeArrays::ConnectingQuad(StrokeNodeOperations & operations, int index)
+{
+    Debug::Assert(index > 0 && index < Count());
+    if (_quads.empty())
+    {
+        _quads.assign(_bounds.size(), Quad::Empty());
+    }
+
+    // Run r holds the quads of nodes [r * RunLength + 1, (r + 1) * RunLength]
+    size_t run = static_cast<size_t>((index - 1) / StrokeNodeBatch::RunLength);
+    if (!_quadRuns[run])
+    {
+        int start = static_cast<int>(run) * StrokeNodeBatch::RunLength;
+        int count = std::min(StrokeNodeBatch::RunLength + 1, Count() - start);
+        operations.GetConnectingQuads(_x.data() + start, _y.data() + start, _pressureFactor.data() + start,
+                                      count, _quads.data() + start);
+        _quadRuns[run] = true;
+    }
+    return _quads[static_cast<size_t>(index)];
+}
+
 INKCANVAS_END_NAMESPACE
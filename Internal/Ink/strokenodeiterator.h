@@ -3,12 +3,17 @@
 
 #include "Windows/Ink/stroke.h"
 #include "Internal/Ink/strokenodeoperations.h"
+#include "Internal/Ink/strokegeometrycache.h"
+
+#include <memory>
+#include <vector>
 
 // namespace MS.Internal.Ink
 INKCANVAS_BEGIN_NAMESPACE
 
 class StrokeNodeOperations;
 class StrokeNode;
+class StrokeNodeArrays;
 
 /// <summary>
 /// This class serves as a unified tool for enumerating through stroke nodes
@@ -35,6 +40,29 @@ public:
     /// </summary>
     static StrokeNodeIterator GetIterator(SharedPointer<StylusPointCollection> stylusPoints, DrawingAttributes& drawingAttributes);
 
+    /// <summary>
+    /// Creates an enumerator for stylusPoints, the stroke's own points or
+    /// its Bezier points, with the stroke's drawing attributes, and caches
+    /// its node arrays on the stroke
+    /// </summary>
+    static StrokeNodeIterator CacheNodes(Stroke & stroke, SharedPointer<StylusPointCollection> stylusPoints);
+
+    /// <summary>
+    /// Creates an enumerator for the nodes of iterator with their positions
+    /// transformed by transform, for drawingAttributes. The nodes are built
+    /// from the positions iterator reads, without copying or clamping its
+    /// stylus points.
+    /// </summary>
+    static StrokeNodeIterator GetTransformedIterator(StrokeNodeIterator const & iterator, Matrix const & transform,
+                                                     DrawingAttributes& drawingAttributes);
+
+    /// <summary>
+    /// Bounds of the nodes of stylusPoints with drawingAttributes, the union
+    /// of their GetNodeBounds, computed from the point extents without
+    /// creating an iterator or any nodes (see StrokeNodeBatch::UnionNodeBounds)
+    /// </summary>
+    static Rect GetBounds(StylusPointCollection const & stylusPoints, DrawingAttributes& drawingAttributes);
+
 
     /// <summary>
     /// GetNormalizedPressureFactor
@@ -115,15 +143,123 @@ public:
     /// <returns></returns>
     StrokeNode GetNode(int index, int previousIndex) const;
 
+    /// <summary>
+    /// Bounds of the node at index, same as operator[](index).GetBounds()
+    /// </summary>
+    Rect GetNodeBounds(int index) const;
+
+    /// <summary>
+    /// Switches the iterator to compact node arrays, built on first call:
+    /// nodes are then created from the arrays instead of the stylus points,
+    /// with node bounds and connecting quads computed by the batch kernels
+    /// </summary>
+    StrokeNodeArrays & MaterializeNodes() const;
+
+    /// <summary>
+    /// The node arrays, nullptr until materialized
+    /// </summary>
+    std::shared_ptr<StrokeNodeArrays> const & Nodes() const { return _nodes; }
+
+    /// <summary>
+    /// Gets positions and pressure factors of the nodes [start, start + count)
+    /// as separate arrays, for the run methods of StrokeNodeOperations
+    /// </summary>
+    void GetNodeRun(int start, int count, double * x, double * y, double * pressureFactor) const;
+
+    /// <summary>
+    /// The points the nodes are created from, nullptr for an incremental
+    /// iterator before its first segment
+    /// </summary>
+    SharedPointer<StylusPointCollection> const & StylusPoints() const { return _stylusPoints; }
+
+    /// <summary>
+    /// The operations the nodes are created with
+    /// </summary>
+    StrokeNodeOperations & Operations() const { return *_operations; }
+
     friend bool operator!=(StrokeNodeIterator const & l, std::nullptr_t)
     {
         return l._stylusPoints != nullptr;
     }
 
 private:
+    friend class StrokeNodeArrays;
+
+    static void GetNodeRun(StylusPointCollection const & stylusPoints, bool usePressure,
+                           int start, int count, double * x, double * y, double * pressureFactor);
+
     SharedPointer<StylusPointCollection>  _stylusPoints;
     std::unique_ptr<StrokeNodeOperations>   _operations;
     bool                    _usePressure;
+    mutable std::shared_ptr<StrokeNodeArrays> _nodes;
+};
+
+/// <summary>
+/// The nodes of a StrokeNodeIterator as compact arrays: positions, pressure
+/// factors, node bounds and connecting quads, computed with the batch
+/// kernels (StrokeNodeBatch). Bounds are computed for all nodes at once,
+/// quads a run at a time when a node of the run is first asked for, since
+/// hit-testing usually needs them for a few nodes only.
+/// A Stroke keeps the arrays built for its own drawing attributes alongside
+/// its geometry, so bounds, rendering and hit-testing share them.
+/// </summary>
+class StrokeNodeArrays
+{
+public:
+    /// <summary>
+    /// Reads the nodes of iterator and computes their bounds
+    /// </summary>
+    StrokeNodeArrays(StrokeNodeIterator const & iterator);
+
+    /// <summary>
+    /// Reads the nodes of iterator with their positions transformed by
+    /// transform, and computes their bounds with operations
+    /// </summary>
+    StrokeNodeArrays(StrokeNodeIterator const & iterator, Matrix const & transform, StrokeNodeOperations & operations);
+
+    int Count() const { return static_cast<int>(_bounds.size()); }
+
+    /// <summary>
+    /// The points the nodes were read from (Bezier points for FitToCurve)
+    /// </summary>
+    SharedPointer<StylusPointCollection> const & StylusPoints() const { return _stylusPoints; }
+
+    /// <summary>
+    /// Same as StrokeNode::GetBounds of the node at index
+    /// </summary>
+    Rect const & Bounds(int index) const { return _bounds[static_cast<size_t>(index)]; }
+
+    /// <summary>
+    /// Position and pressure factor of the node at index
+    /// </summary>
+    StrokeNodeData NodeData(int index) const;
+
+    /// <summary>
+    /// The quad connecting the node at index to the node before it
+    /// </summary>
+    Quad const & ConnectingQuad(StrokeNodeOperations & operations, int index);
+
+    /// <summary>
+    /// Memory held by the arrays, the quads counted in full before they are
+    /// built: rendering builds all of them
+    /// </summary>
+    size_t ByteSize() const;
+
+    /// <summary>
+    /// The drawing attributes the nodes were built for, when cached by a stroke
+    /// </summary>
+    StrokeGeometryKey const & Key() const { return _key; }
+    void SetKey(StrokeGeometryKey const & key) { _key = key; }
+
+private:
+    SharedPointer<StylusPointCollection> _stylusPoints;
+    StrokeGeometryKey   _key;
+    std::vector<double> _x;
+    std::vector<double> _y;
+    std::vector<double> _pressureFactor;
+    std::vector<Rect>   _bounds;
+    std::vector<Quad>   _quads;
+    std::vector<bool>   _quadRuns;
 };
 
 INKCANVAS_END_NAMESPACE
@@ -1,5 +1,6 @@
 #include "Internal/Ink/strokenodeoperations.h"
 #include "Internal/Ink/ellipticalnodeoperations.h"
+#include "Internal/Ink/strokenodebatch.h"
 #include "Internal/debug.h"
 
 INKCANVAS_BEGIN_NAMESPACE
@@ -26,6 +27,7 @@ StrokeNodeOperations::StrokeNodeOperations(StylusShape & nodeShape)
 {
     //Debug::Assert(nodeShape != nullptr);
     _vertices = nodeShape.GetVerticesAsVectors();
+    _shapeBounds = nodeShape.VerticesBounds();
 }
 
 StrokeNodeOperations::~StrokeNodeOperations()
@@ -40,19 +42,6 @@ StrokeNodeOperations::~StrokeNodeOperations()
 /// <returns>bounds of the node</returns>
 Rect StrokeNodeOperations::GetNodeBounds(StrokeNodeData const & node)
 {
-    if (_shapeBounds.IsEmpty())
-    {
-        int i;
-        for (i = 0; (i + 1) < _vertices.Length(); i += 2)
-        {
-            _shapeBounds.Union(Rect((Point)_vertices[i], (Point)_vertices[i + 1]));
-        }
-        if (i < _vertices.Length())
-        {
-            _shapeBounds .Union((Point)_vertices[i]);
-        }
-    }
-
     Rect boundingBox = _shapeBounds;
     Debug::Assert((boundingBox.X() <= 0) && (boundingBox.Y() <= 0));
 
@@ -71,9 +60,18 @@ Rect StrokeNodeOperations::GetNodeBounds(StrokeNodeData const & node)
     return boundingBox;
 }
 
+/// <summary>
+/// Computes the bounds of count nodes at once, see StrokeNodeBatch
+/// </summary>
+void StrokeNodeOperations::GetNodeBounds(double const * x, double const * y, double const * pressureFactor, int count, Rect * bounds)
+{
+    StrokeNodeBatch::GetNodeBounds(_shapeBounds, x, y, pressureFactor, count, bounds);
+}
+
 void StrokeNodeOperations::GetNodeContourPoints(StrokeNodeData const & node, List<Point> & pointBuffer)
 {
     double pressureFactor = node.PressureFactor();
+    pointBuffer.reserve(pointBuffer.Count() + _vertices.Length());
     if (DoubleUtil::AreClose(pressureFactor, 1))
     {
         for (int i = 0; i < _vertices.Length(); i++)
@@ -97,12 +95,12 @@ void StrokeNodeOperations::GetNodeContourPoints(StrokeNodeData const & node, Lis
 /// </summary>
 /// <param name="node">node</param>
 /// <param name="quad">quadrangle connecting the node to the preceeding node</param>
-/// <returns>contour segments enumerator</returns>
-List<ContourSegment> StrokeNodeOperations::GetContourSegments(StrokeNodeData const& node, Quad const & quad)
+/// <param name="result">receives the contour segments, cleared first</param>
+void StrokeNodeOperations::GetContourSegments(StrokeNodeData const& node, Quad const & quad, ContourSegmentBuffer & result)
 {
     Debug::Assert(node.IsEmpty() == false);
 
-    List<ContourSegment> result;
+    result.Clear();
     if (quad.IsEmpty())
     {
         Point vertex = node.Position() + (_vertices[_vertices.Length() - 1] * node.PressureFactor());
@@ -136,7 +134,6 @@ List<ContourSegment> StrokeNodeOperations::GetContourSegments(StrokeNodeData con
         result.Add(ContourSegment(quad.C(), quad.D()));
         result.Add(ContourSegment(quad.D(), quad.A()));
     }
-    return result;
 }
 
 /// <summary>
@@ -144,14 +141,28 @@ List<ContourSegment> StrokeNodeOperations::GetContourSegments(StrokeNodeData con
 /// </summary>
 /// <param name="beginNode"></param>
 /// <param name="endNode"></param>
-/// <returns></returns>
-List<ContourSegment> StrokeNodeOperations::GetNonBezierContourSegments(StrokeNodeData const& beginNode, StrokeNodeData const& endNode)
+/// <param name="result">receives the contour segments, cleared first</param>
+void StrokeNodeOperations::GetNonBezierContourSegments(StrokeNodeData const& beginNode, StrokeNodeData const& endNode, ContourSegmentBuffer & result)
 {
     Quad quad = beginNode.IsEmpty() ? Quad::Empty() : GetConnectingQuad(beginNode, endNode);
-    return GetContourSegments(endNode, quad);
+    GetContourSegments(endNode, quad, result);
 }
 
 
+/// <summary>
+/// Finds connecting quads for each pair of adjacent nodes of a run,
+/// quads[i] connects node i - 1 to node i
+/// </summary>
+void StrokeNodeOperations::GetConnectingQuads(double const * x, double const * y, double const * pressureFactor, int count, Quad * quads)
+{
+    for (int i = 1; i < count; i++)
+    {
+        quads[i] = GetConnectingQuad(
+            StrokeNodeData(Point(x[i - 1], y[i - 1]), static_cast<float>(pressureFactor[i - 1])),
+            StrokeNodeData(Point(x[i], y[i]), static_cast<float>(pressureFactor[i])));
+    }
+}
+
 /// <summary>
 /// Finds connecting points for a pair of stroke nodes (of a polygonal shape)
 /// </summary>
@@ -417,7 +428,7 @@ bool StrokeNodeOperations::HitTest(
 /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
 /// <returns>true if the contours intersect or overlap</returns>
 bool StrokeNodeOperations::HitTest(
-    StrokeNodeData const& beginNode, StrokeNodeData const& endNode, Quad const& quad, List<ContourSegment> const& hitContour)
+    StrokeNodeData const& beginNode, StrokeNodeData const& endNode, Quad const& quad, ContourSegmentBuffer const & hitContour)
 {
     // Check for special cases when the endNode is the very first one (beginNode.IsEmpty())
     // or one node is completely inside the other. In either case the connecting quad
@@ -543,7 +554,7 @@ StrokeFIndices StrokeNodeOperations::CutTest(
 /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
 /// <returns></returns>
 StrokeFIndices StrokeNodeOperations::CutTest(
-    StrokeNodeData const& beginNode, StrokeNodeData const& endNode, Quad const& quad, List<ContourSegment> const& hitContour)
+    StrokeNodeData const& beginNode, StrokeNodeData const& endNode, Quad const& quad, ContourSegmentBuffer const & hitContour)
 {
     if (beginNode.IsEmpty())
     {
@@ -913,7 +924,7 @@ double StrokeNodeOperations::ClipTestArc(Vector const & spineVector, double pres
 /// <param name="endNode">End node of the stroke segment</param>
 /// <returns>true if hit; false otherwise</returns>
 bool StrokeNodeOperations::HitTestPolygonContourSegments(
-    List<ContourSegment> const& hitContour, StrokeNodeData const& beginNode, StrokeNodeData const& endNode)
+    ContourSegmentBuffer const & hitContour, StrokeNodeData const& beginNode, StrokeNodeData const& endNode)
 {
     bool isHit = false;
 
@@ -1002,7 +1013,7 @@ bool StrokeNodeOperations::HitTestPolygonContourSegments(
 /// <param name="endNode">End node of the stroke segment</param>
 /// <returns>true if hit; false otherwise</returns>
 bool StrokeNodeOperations::HitTestInkContour(
-    List<ContourSegment> const& hitContour, Quad const& quad, StrokeNodeData const& beginNode, StrokeNodeData const &endNode)
+    ContourSegmentBuffer const & hitContour, Quad const& quad, StrokeNodeData const& beginNode, StrokeNodeData const &endNode)
 {
     Debug::Assert(!quad.IsEmpty());
     bool isHit = false;
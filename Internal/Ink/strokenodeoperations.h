@@ -56,6 +56,16 @@ public:
     /// <returns>bounds of the node</returns>
     Rect GetNodeBounds(StrokeNodeData const & node);
 
+    /// <summary>
+    /// Computes the bounds of count nodes at once, see StrokeNodeBatch
+    /// </summary>
+    /// <param name="x">x of the node positions</param>
+    /// <param name="y">y of the node positions</param>
+    /// <param name="pressureFactor">pressure factors of the nodes</param>
+    /// <param name="count">number of nodes</param>
+    /// <param name="bounds">receives the bounds of the nodes</param>
+    void GetNodeBounds(double const * x, double const * y, double const * pressureFactor, int count, Rect * bounds);
+
     void GetNodeContourPoints(StrokeNodeData const & node, List<Point> & pointBuffer);
 
     /// <summary>
@@ -65,16 +75,16 @@ public:
     /// </summary>
     /// <param name="node">node</param>
     /// <param name="quad">quadrangle connecting the node to the preceeding node</param>
-    /// <returns>contour segments enumerator</returns>
-    virtual List<ContourSegment> GetContourSegments(StrokeNodeData const & node, Quad const & quad);
+    /// <param name="result">receives the contour segments, cleared first</param>
+    virtual void GetContourSegments(StrokeNodeData const & node, Quad const & quad, ContourSegmentBuffer & result);
 
     /// <summary>
     /// ISSUE-2004/06/15- temporary workaround to avoid hit-testing ellipses with ellipses
     /// </summary>
     /// <param name="beginNode"></param>
     /// <param name="endNode"></param>
-    /// <returns></returns>
-    virtual List<ContourSegment> GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode);
+    /// <param name="result">receives the contour segments, cleared first</param>
+    virtual void GetNonBezierContourSegments(StrokeNodeData const & beginNode, StrokeNodeData const & endNode, ContourSegmentBuffer & result);
 
 
     /// <summary>
@@ -85,6 +95,17 @@ public:
     /// <returns>connecting quadrangle, that can be empty if one node is inside the other</returns>
     virtual Quad GetConnectingQuad(StrokeNodeData const & beginNode, StrokeNodeData const & endNode);
 
+    /// <summary>
+    /// Finds connecting quads for each pair of adjacent nodes of a run,
+    /// quads[i] connects node i - 1 to node i, quads[0] is left untouched
+    /// </summary>
+    /// <param name="x">x of the node positions</param>
+    /// <param name="y">y of the node positions</param>
+    /// <param name="pressureFactor">pressure factors of the nodes</param>
+    /// <param name="count">number of nodes</param>
+    /// <param name="quads">receives the connecting quads</param>
+    virtual void GetConnectingQuads(double const * x, double const * y, double const * pressureFactor, int count, Quad * quads);
+
     /// <summary>
     /// Hit-tests ink segment defined by two nodes against a linear segment.
     /// </summary>
@@ -107,7 +128,7 @@ public:
     /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
     /// <returns>true if the contours intersect or overlap</returns>
     virtual bool HitTest(
-        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, List<ContourSegment> const & hitContour);
+        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, ContourSegmentBuffer const & hitContour);
 
     /// <summary>
     /// Hit-tests ink segment defined by two nodes against a linear segment.
@@ -131,7 +152,7 @@ public:
     /// <param name="hitContour">a collection of basic segments outlining the hitting contour</param>
     /// <returns></returns>
     virtual StrokeFIndices CutTest(
-        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, List<ContourSegment> const & hitContour);
+        StrokeNodeData const & beginNode, StrokeNodeData const & endNode, Quad const& quad, ContourSegmentBuffer const & hitContour);
 
     /// <summary>
     /// Cutting ink with polygonal tip shapes with a linear segment
@@ -174,7 +195,7 @@ public:
     /// <param name="endNode">End node of the stroke segment</param>
     /// <returns>true if hit; false otherwise</returns>
     bool HitTestPolygonContourSegments(
-        List<ContourSegment> const & hitContour, StrokeNodeData const & beginNode, StrokeNodeData const & endNode);
+        ContourSegmentBuffer const & hitContour, StrokeNodeData const & beginNode, StrokeNodeData const & endNode);
 
     /// <summary>
     /// Helper function to HitTest the the hitting contour against the inking contour
@@ -185,7 +206,7 @@ public:
     /// <param name="endNode">End node of the stroke segment</param>
     /// <returns>true if hit; false otherwise</returns>
     bool HitTestInkContour(
-        List<ContourSegment> const & hitContour, Quad const& quad, StrokeNodeData const & beginNode, StrokeNodeData const &endNode);
+        ContourSegmentBuffer const & hitContour, Quad const& quad, StrokeNodeData const & beginNode, StrokeNodeData const &endNode);
 
 
     /// <summary>
@@ -218,7 +239,7 @@ public:
 
     // Shape parameters
 private:
-    Rect        _shapeBounds = Rect::Empty();
+    Rect        _shapeBounds;
     Array<Vector>    _vertices;
 
 public:
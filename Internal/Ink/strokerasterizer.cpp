@@ -0,0 +1,140 @@
+#include "Internal/Ink/strokerasterizer.h"
+#include "Internal/Ink/strokerenderer.h"
+#include "Windows/Ink/stroke.h"
+#include "Windows/Ink/strokecollection.h"
+#include "Windows/Ink/drawingattributes.h"
+
+#include <map>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+static void PremultipliedColor(unsigned int color, float opacity, float (&out)[4])
+{
+    float a = static_cast<float>(color >> 24) * opacity / 255.0f;
+    out[0] = static_cast<float>((color >> 16) & 0xFF) * a;
+    out[1] = static_cast<float>((color >> 8) & 0xFF) * a;
+    out[2] = static_cast<float>(color & 0xFF) * a;
+    out[3] = 255.0f * a;
+}
+
+StrokeRasterizer::StrokeRasterizer(unsigned char * pixels, int width, int height, int stride)
+    : pixels_(pixels)
+    , width_(width)
+    , height_(height)
+    , stride_(stride)
+{
+}
+
+void StrokeRasterizer::SetTransform(Matrix const & transform)
+{
+    transform_ = transform;
+}
+
+void StrokeRasterizer::Clear(unsigned int color)
+{
+    float c[4];
+    PremultipliedColor(color, 1.0f, c);
+    unsigned char px[4] = {
+        static_cast<unsigned char>(c[0] + 0.5f), static_cast<unsigned char>(c[1] + 0.5f),
+        static_cast<unsigned char>(c[2] + 0.5f), static_cast<unsigned char>(c[3] + 0.5f) };
+    for (int y = 0; y < height_; ++y)
+    {
+        unsigned char * row = pixels_ + y * stride_;
+        for (int x = 0; x < width_; ++x, row += 4)
+        {
+            row[0] = px[0]; row[1] = px[1]; row[2] = px[2]; row[3] = px[3];
+        }
+    }
+}
+
+void StrokeRasterizer::Draw(Stroke & stroke, unsigned int color)
+{
+    if (!Prepare(stroke))
+        return;
+    float c[4];
+    PremultipliedColor(color, 1.0f, c);
+    rasterizer_.Rasterize(width_, height_, [this, &c](int y, int x, int count, float const * coverage) {
+        Blend(y, x, count, coverage, c);
+    });
+}
+
+void StrokeRasterizer::Draw(StrokeCollection & strokes, ColorSelector const & color)
+{
+    List<Stroke*> solidStrokes;
+    // same order as the QMap<QColor, ...> in StrokeCollection::Draw
+    std::map<unsigned int, List<Stroke*>> highLighters;
+
+    for (int i = 0; i < strokes.Count(); i++)
+    {
+        Stroke * stroke = strokes[i].get();
+        if (stroke->GetDrawingAttributes()->IsHighlighter())
+        {
+            // Colors of the same RGB but different Alpha are in the same layer
+            highLighters[color(*stroke) | 0xFF000000].Add(stroke);
+        }
+        else
+        {
+            solidStrokes.Add(stroke);
+        }
+    }
+
+    for (auto & group : highLighters)
+    {
+        // union the coverage of the group, so overlapping highlighters of
+        //  one color don't get darker, then blend it once
+        mask_.resize(static_cast<size_t>(width_) * static_cast<size_t>(height_));
+        int top = height_, bottom = 0;
+        for (Stroke * stroke : group.second)
+        {
+            if (!Prepare(*stroke))
+                continue;
+            rasterizer_.Rasterize(width_, height_, [this, &top, &bottom](int y, int x, int count, float const * coverage) {
+                float * m = mask_.data() + y * width_ + x;
+                for (int i = 0; i < count; ++i)
+                    m[i] = std::max(m[i], coverage[i]);
+                top = std::min(top, y);
+                bottom = std::max(bottom, y + 1);
+            });
+        }
+        float c[4];
+        PremultipliedColor(group.first, static_cast<float>(StrokeRenderer::HighlighterOpacity), c);
+        for (int y = top; y < bottom; ++y)
+        {
+            float * m = mask_.data() + y * width_;
+            Blend(y, 0, width_, m, c);
+            std::fill(m, m + width_, 0.0f);
+        }
+    }
+
+    for (Stroke * stroke : solidStrokes)
+    {
+        Draw(*stroke, color(*stroke));
+    }
+}
+
+bool StrokeRasterizer::Prepare(Stroke & stroke)
+{
+    Rect bounds = transform_.Transform(stroke.GetBounds());
+    if (!bounds.IntersectsWith(Rect(0, 0, width_, height_)))
+        return false;
+    rasterizer_.Reset();
+    rasterizer_.SetTransform(transform_);
+    stroke.GetGeometry(rasterizer_);
+    return !rasterizer_.IsEmpty();
+}
+
+void StrokeRasterizer::Blend(int y, int x, int count, float const * coverage, float const (&color)[4])
+{
+    unsigned char * p = pixels_ + y * stride_ + x * 4;
+    for (int i = 0; i < count; ++i, p += 4)
+    {
+        float k = coverage[i];
+        if (k <= 0)
+            continue;
+        float inv = 1.0f - color[3] / 255.0f * k;
+        for (int j = 0; j < 4; ++j)
+            p[j] = static_cast<unsigned char>(color[j] * k + p[j] * inv + 0.5f);
+    }
+}
+
+INKCANVAS_END_NAMESPACE
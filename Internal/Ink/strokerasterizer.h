@@ -0,0 +1,71 @@
+#ifndef STROKERASTERIZER_H
+#define STROKERASTERIZER_H
+
+#include "InkCanvas_global.h"
+#include "Windows/Media/scanlinerasterizer.h"
+
+#include <functional>
+#include <vector>
+
+// namespace MS.Internal.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+class Stroke;
+class StrokeCollection;
+
+/// <summary>
+/// Renders strokes into a caller owned pixel buffer without a DrawingContext,
+/// for INKCANVAS_CORE builds (thumbnails, server side previews).
+/// Pixels are 8 bit premultiplied RGBA, in that byte order.
+/// Colors are passed as 0xAARRGGBB, not premultiplied.
+/// </summary>
+class StrokeRasterizer
+{
+public:
+    typedef std::function<unsigned int (Stroke & stroke)> ColorSelector;
+
+    StrokeRasterizer(unsigned char * pixels, int width, int height, int stride);
+
+    /// <summary>
+    /// Transform from ink to pixel coordinates, e.g. a scaling for thumbnails
+    /// </summary>
+    void SetTransform(Matrix const & transform);
+
+    /// <summary>
+    /// Fills the whole buffer with color
+    /// </summary>
+    void Clear(unsigned int color);
+
+    /// <summary>
+    /// Draws one stroke with color, ignoring IsHighlighter
+    /// </summary>
+    void Draw(Stroke & stroke, unsigned int color);
+
+    /// <summary>
+    /// Draws the strokes like StrokeCollection::Draw does: highlighters first,
+    /// grouped by color and blended as one layer per color at
+    /// StrokeRenderer::HighlighterOpacity, then the solid strokes in z-order.
+    /// DrawingAttributes carry no color in INKCANVAS_CORE builds, so the
+    /// caller supplies it.
+    /// </summary>
+    void Draw(StrokeCollection & strokes, ColorSelector const & color);
+
+private:
+    bool Prepare(Stroke & stroke);
+
+    void Blend(int y, int x, int count, float const * coverage, float const (&color)[4]);
+
+private:
+    unsigned char * pixels_;
+    int width_;
+    int height_;
+    int stride_;
+    Matrix transform_;
+    ScanlineRasterizer rasterizer_;
+    // coverage union of a highlighter group, allocated on first use
+    std::vector<float> mask_;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // STROKERASTERIZER_H
@@ -3,14 +3,53 @@
 #include "Internal/Ink/strokenodeiterator.h"
 #include "Windows/Media/streamgeometrycontext.h"
 #include "Windows/Media/streamgeometry.h"
+#include "Windows/Media/simplifyingstreamgeometrycontext.h"
+#include "Windows/Media/transformingstreamgeometrycontext.h"
 #include "Internal/finallyhelper.h"
 #include "Internal/debug.h"
 
+#include <atomic>
+#include <stdexcept>
+
 
 INKCANVAS_BEGIN_NAMESPACE
 
 Point StrokeRenderer::ArcToMarker(Double::MinValue, Double::MinValue);
 
+static std::atomic<double> s_outlineTolerance(0);
+static std::atomic<double> s_outlineDeviceScale(1);
+static std::atomic<int> s_outlineGeneration(0);
+
+double StrokeRenderer::OutlineTolerance()
+{
+    return s_outlineTolerance.load(std::memory_order_relaxed);
+}
+
+double StrokeRenderer::OutlineDeviceScale()
+{
+    return s_outlineDeviceScale.load(std::memory_order_relaxed);
+}
+
+void StrokeRenderer::SetOutlineTolerance(double tolerance, double deviceScale)
+{
+    if (!(deviceScale > 0))
+    {
+        throw std::runtime_error("deviceScale");
+    }
+    if (tolerance < 0)
+        tolerance = 0;
+    double oldTolerance = s_outlineTolerance.exchange(tolerance, std::memory_order_relaxed);
+    double oldScale = s_outlineDeviceScale.exchange(deviceScale, std::memory_order_relaxed);
+    // without a tolerance the scale doesn't matter
+    if (oldTolerance != tolerance || (tolerance > 0 && oldScale != deviceScale))
+        s_outlineGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+int StrokeRenderer::OutlineGeneration()
+{
+    return s_outlineGeneration.load(std::memory_order_relaxed);
+}
+
 /// <summary>
 /// Calculate the StreamGeometry for the StrokeNodes.
 /// This method is one of our most sensitive perf paths.  It has been optimized to
@@ -26,16 +65,11 @@ void StrokeRenderer::CalcGeometryAndBoundsWithTransform(StrokeNodeIterator& iter
                                                    Geometry*& geometry,
                                                    Rect& bounds)
 {
-    //Debug::Assert(iterator != nullptr);
-    //Debug::Assert(drawingAttributes != nullptr);
-    (void) drawingAttributes;
-
     StreamGeometry* streamGeometry= new StreamGeometry;
     streamGeometry->SetFillRule(FillRule::Nonzero);
 
     StreamGeometryContext& context = streamGeometry->Open();
     geometry = streamGeometry;
-    bounds = Rect::Empty();
 
     //try
     {
@@ -44,6 +78,33 @@ void StrokeRenderer::CalcGeometryAndBoundsWithTransform(StrokeNodeIterator& iter
             //geometry.Freeze();
         });
 
+        CalcGeometryAndBoundsWithTransform(iterator, drawingAttributes, stylusTipMatrixType, calculateBounds, context, bounds);
+    }
+    //finally
+    //{
+    //    context.Close();
+    //    geometry.Freeze();
+    //}
+}
+
+/// <summary>
+/// Same as above, but renders into a caller supplied StreamGeometryContext,
+/// which is left open.
+/// </summary>
+void StrokeRenderer::CalcGeometryAndBoundsWithTransform(StrokeNodeIterator& iterator,
+                                                   DrawingAttributes& drawingAttributes,
+                                                   MatrixTypes stylusTipMatrixType,
+                                                   bool calculateBounds,
+                                                   StreamGeometryContext& context,
+                                                   Rect& bounds)
+{
+    //Debug::Assert(iterator != nullptr);
+    //Debug::Assert(drawingAttributes != nullptr);
+    (void) drawingAttributes;
+
+    bounds = Rect::Empty();
+
+    {
         List<Point> connectingQuadPoints; connectingQuadPoints.reserve(iterator.Count() * 4);
 
         //the index that the cb quad points are copied to
@@ -178,11 +239,6 @@ void StrokeRenderer::CalcGeometryAndBoundsWithTransform(StrokeNodeIterator& iter
             }
         }
     }
-    //finally
-    //{
-    //    context.Close();
-    //    geometry.Freeze();
-    //}
 }
 
 
@@ -206,32 +262,146 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                                            Geometry*& geometry,
                                            Rect &bounds)
 {
+    StreamGeometry * streamGeometry = new StreamGeometry;
+    streamGeometry->SetFillRule(FillRule::Nonzero);
+
+    StreamGeometryContext& context = streamGeometry->Open();
+    geometry = streamGeometry;
+    //try
+    {
+        FinallyHelper final([&context](){
+            context.Close();
+            //geometry.Freeze();
+        });
+
+        CalcGeometryAndBounds(iterator, drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                              debugDC, feedbackSize, showFeedback,
+#endif
+                              calculateBounds, context, bounds);
+    }
+    //finally
+    //{
+    //    context.Close();
+    //    geometry.Freeze();
+    //}
+}
+
+/// <summary>
+/// Same as above, but renders into a caller supplied StreamGeometryContext,
+/// which is left open. Lets consumers that don't keep a StreamGeometry
+/// (like the ScanlineRasterizer) take the figures directly.
+/// </summary>
+void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
+                                           DrawingAttributes& drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                           DrawingContext& debugDC,
+                                           double feedbackSize,
+                                           bool showFeedback,
+#endif
+                                           bool calculateBounds,
+                                           StreamGeometryContext& context,
+                                           Rect &bounds)
+{
+    // device pixels to stroke units
+    double tolerance = OutlineTolerance() / OutlineDeviceScale();
+    if (tolerance > 0)
+    {
+        // simplify the figures on their way to the context
+        SimplifyingStreamGeometryContext simplifier(context, tolerance);
+        CalcGeometryAndBoundsCore(iterator, drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                  debugDC, feedbackSize, showFeedback,
+#endif
+                                  calculateBounds, simplifier, bounds);
+        simplifier.Flush();
+    }
+    else
+    {
+        CalcGeometryAndBoundsCore(iterator, drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                  debugDC, feedbackSize, showFeedback,
+#endif
+                                  calculateBounds, context, bounds);
+    }
+}
+
+/// <summary>
+/// The drawing attributes of the tip space of drawingAttributes: its tip,
+/// size and pressure use with an identity tip transform. Kept per thread
+/// and replaced when another tip comes, not cloned for each geometry.
+/// </summary>
+static DrawingAttributes & GetTipSpaceAttributes(DrawingAttributes & drawingAttributes)
+{
+    static thread_local SharedPointer<DrawingAttributes> tipSpaceAttributes;
+    if (tipSpaceAttributes == nullptr
+            || tipSpaceAttributes->GetStylusTip() != drawingAttributes.GetStylusTip()
+            || tipSpaceAttributes->Width() != drawingAttributes.Width()
+            || tipSpaceAttributes->Height() != drawingAttributes.Height()
+            || tipSpaceAttributes->IgnorePressure() != drawingAttributes.IgnorePressure())
+    {
+        tipSpaceAttributes.reset(new DrawingAttributes());
+        tipSpaceAttributes->SetStylusTip(drawingAttributes.GetStylusTip());
+        tipSpaceAttributes->SetWidth(drawingAttributes.Width());
+        tipSpaceAttributes->SetHeight(drawingAttributes.Height());
+        tipSpaceAttributes->SetIgnorePressure(drawingAttributes.IgnorePressure());
+    }
+    return *tipSpaceAttributes;
+}
+
+void StrokeRenderer::CalcGeometryAndBoundsCore(StrokeNodeIterator& iterator,
+                                           DrawingAttributes& drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                           DrawingContext& debugDC,
+                                           double feedbackSize,
+                                           bool showFeedback,
+#endif
+                                           bool calculateBounds,
+                                           StreamGeometryContext& context,
+                                           Rect &bounds)
+{
 
     Debug::Assert(iterator != nullptr /*&& drawingAttributes != nullptr*/);
 
-    //we can use our new algorithm for identity only.
+    //we can use our new algorithm for identity and scaling only.
     Matrix stylusTipTransform(drawingAttributes.StylusTipTransform());
     if (stylusTipTransform != Matrix::Identity() && stylusTipTransform._type != MatrixTypes::TRANSFORM_IS_SCALING)
     {
-        //second best optimization
-        CalcGeometryAndBoundsWithTransform(iterator, drawingAttributes, stylusTipTransform._type, calculateBounds, geometry, bounds);
+        if (stylusTipTransform.HasInverse() && iterator.StylusPoints() != nullptr)
+        {
+            //
+            // Sweeping the transformed tip along the points gives the transform of sweeping
+            // the plain tip along the points transformed back. Do the latter with our new
+            // algorithm, in tip space, and transform the figures on their way to context.
+            //
+            Matrix tipSpaceTransform = stylusTipTransform;
+            tipSpaceTransform.Invert();
+            DrawingAttributes & tipSpaceAttributes = GetTipSpaceAttributes(drawingAttributes);
+            StrokeNodeIterator tipSpaceIterator =
+                StrokeNodeIterator::GetTransformedIterator(iterator, tipSpaceTransform, tipSpaceAttributes);
+
+            TransformingStreamGeometryContext tipSpaceContext(context, stylusTipTransform);
+            Rect tipSpaceBounds;
+            CalcGeometryAndBoundsCore(tipSpaceIterator, tipSpaceAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                      debugDC, feedbackSize, showFeedback,
+#endif
+                                      false, tipSpaceContext, tipSpaceBounds);
+
+            // the transformed tip space bounds would be too large, union the nodes instead
+            bounds = calculateBounds ? StrokeNodeIterator::GetBounds(*iterator.StylusPoints(), drawingAttributes) : Rect::Empty();
+        }
+        else
+        {
+            //second best optimization
+            CalcGeometryAndBoundsWithTransform(iterator, drawingAttributes, stylusTipTransform._type, calculateBounds, context, bounds);
+        }
     }
     else
     {
-
-        StreamGeometry * streamGeometry = new StreamGeometry;
-        streamGeometry->SetFillRule(FillRule::Nonzero);
-
-        StreamGeometryContext& context = streamGeometry->Open();
-        geometry = streamGeometry;
         Rect empty = Rect::Empty();
         bounds = empty;
-        //try
         {
-            FinallyHelper final([&context](){
-                context.Close();
-                //geometry.Freeze();
-            });
             //
             // We keep track of three StrokeNodes as we iterate across
             // the Stroke. Since these are structs, the default ctor will
@@ -264,6 +434,10 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
             List<Point> polyLinePoints;//(4);
 
             int iteratorCount = iterator.Count();
+
+            // Node bounds and connecting quads from the batch kernels
+            iterator.MaterializeNodes();
+
             for (int index = 0, previousIndex = -1; index < iteratorCount; )
             {
                 if (!prevPrevStrokeNode.IsValid())
@@ -278,7 +452,7 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                     else
                     {
                         prevPrevStrokeNode = iterator.GetNode(index++, previousIndex++);
-                        prevPrevStrokeNodeBounds = prevPrevStrokeNode.GetBounds();
+                        prevPrevStrokeNodeBounds = iterator.GetNodeBounds(index - 1);
                         continue; //so we always check if index < iterator.Count
                     }
                 }
@@ -297,7 +471,7 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                     {
                         //get the next strokeNode, but don't automatically update previousIndex
                         prevStrokeNode = iterator.GetNode(index++, previousIndex);
-                        prevStrokeNodeBounds = prevStrokeNode.GetBounds();
+                        prevStrokeNodeBounds = iterator.GetNodeBounds(index - 1);
 
                         RectCompareResult result =
                             FuzzyContains(  prevStrokeNodeBounds,
@@ -361,7 +535,7 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                 if (!strokeNode.IsValid())
                 {
                     strokeNode = iterator.GetNode(index++, previousIndex);
-                    strokeNodeBounds = strokeNode.GetBounds();
+                    strokeNodeBounds = iterator.GetNodeBounds(index - 1);
 
                     RectCompareResult result =
                             FuzzyContains(  strokeNodeBounds,
@@ -393,7 +567,7 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                         //prevPrevStrokeNode.  We need to gen one
                         //without a connecting quad
                         prevPrevStrokeNode = iterator.GetNode(index - 1, prevPrevStrokeNode.Index() - 1);
-                        prevPrevStrokeNodeBounds = prevPrevStrokeNode.GetBounds();
+                        prevPrevStrokeNodeBounds = iterator.GetNodeBounds(index - 1);
                         prevStrokeNode = emptyStrokeNode;
                         strokeNode = emptyStrokeNode;
 
@@ -732,11 +906,6 @@ void StrokeRenderer::CalcGeometryAndBounds(StrokeNodeIterator& iterator,
                 }
             }
         }
-        //finally
-        //{
-        //    context.Close();
-        //    geometry.Freeze();
-        //}
     }
 }
 
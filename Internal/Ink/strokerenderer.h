@@ -41,6 +41,13 @@ public:
                                                    Geometry*& geometry,
                                                    Rect& bounds);
 
+    static void CalcGeometryAndBoundsWithTransform(StrokeNodeIterator& iterator,
+                                                   DrawingAttributes& drawingAttributes,
+                                                   MatrixTypes stylusTipMatrixType,
+                                                   bool calculateBounds,
+                                                   StreamGeometryContext& context,
+                                                   Rect& bounds);
+
 
     /// <summary>
     /// Calculate the StreamGeometry for the StrokeNodes.
@@ -62,7 +69,61 @@ public:
                                                Geometry*& geometry,
                                                Rect& bounds);
 
+    /// <summary>
+    /// Calculate the figures for the StrokeNodes into a caller supplied context.
+    /// The context is not closed.
+    /// </summary>
+    static void CalcGeometryAndBounds(StrokeNodeIterator& iterator,
+                                               DrawingAttributes& drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                               DrawingContext& debugDC,
+                                               double feedbackSize,
+                                               bool showFeedback,
+#endif
+                                               bool calculateBounds,
+                                               StreamGeometryContext& context,
+                                               Rect& bounds);
+
+    /// <summary>
+    /// Largest distance, in device pixels, the figures of CalcGeometryAndBounds
+    /// may be off the stroke node contours. Collinear points of the outlines
+    /// are merged and curved stretches fitted with beziers within it.
+    /// 0, the default, keeps all contour points.
+    /// </summary>
+    static double OutlineTolerance();
+
+    /// <summary>
+    /// Device pixels per stroke unit the outlines are drawn at, view zoom
+    /// times device pixel ratio, 1 by default
+    /// </summary>
+    static double OutlineDeviceScale();
+
+    /// <summary>
+    /// Sets the tolerance in device pixels and the scale the strokes are shown
+    /// at, call again when the zoom changes. A change invalidates the
+    /// geometries cached by strokes, they are built again when next asked for;
+    /// visuals already rendered keep theirs until they are redrawn.
+    /// </summary>
+    static void SetOutlineTolerance(double tolerance, double deviceScale = 1.0);
+
+    /// <summary>
+    /// Changes whenever the outlines built by CalcGeometryAndBounds would
+    /// change, geometries built under another generation are stale
+    /// </summary>
+    static int OutlineGeneration();
+
 private:
+    static void CalcGeometryAndBoundsCore(StrokeNodeIterator& iterator,
+                                               DrawingAttributes& drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                               DrawingContext& debugDC,
+                                               double feedbackSize,
+                                               bool showFeedback,
+#endif
+                                               bool calculateBounds,
+                                               StreamGeometryContext& context,
+                                               Rect& bounds);
+
     /// <summary>
     /// Helper routine to render two distinct stroke nodes
     /// </summary>
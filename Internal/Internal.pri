@@ -5,10 +5,12 @@ HEADERS += \
     $$PWD/debug.h \
     $$PWD/doubleutil.h \
     $$PWD/finallyhelper.h \
+    $$PWD/latencytrace.h \
     $$PWD/matrixutil.h
 
 SOURCES += \
     $$PWD/debug.cpp \
     $$PWD/doubleutil.cpp \
     $$PWD/finallyhelper.cpp \
+    $$PWD/latencytrace.cpp \
     $$PWD/matrixutil.cpp
@@ -0,0 +1,225 @@
+#include "Internal/latencytrace.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+// Log-linear buckets: exact below 16us, then 8 sub-buckets per power of two
+static constexpr int LinearBuckets = 16;
+static constexpr int SubBuckets = 8;
+static constexpr int MaxExponent = 32;
+static constexpr int BucketCount = LinearBuckets + (MaxExponent - 4) * SubBuckets;
+
+// Recent events kept for the Chrome trace, power of two
+static constexpr uint64_t EventCapacity = 8192;
+
+struct Histogram
+{
+    std::atomic<uint32_t> buckets[BucketCount];
+    std::atomic<uint64_t> count;
+    std::atomic<int64_t> max;
+};
+
+struct Event
+{
+    // seqlock: index + 1 when complete, 0 while being written
+    std::atomic<uint64_t> seq;
+    std::atomic<int64_t> begin;
+    std::atomic<int64_t> duration;
+    std::atomic<int> stage;
+    std::atomic<int> thread;
+};
+
+static std::atomic<bool> s_enabled(false);
+static Histogram s_histograms[LatencyTrace::StageCount];
+static Event s_events[EventCapacity];
+static std::atomic<uint64_t> s_nextEvent(0);
+static std::atomic<int64_t> s_pendingCommit(-1);
+static std::atomic<int> s_nextThread(1);
+
+static int BucketOf(uint64_t us)
+{
+    if (us < LinearBuckets)
+        return static_cast<int>(us);
+    int e = 0;
+    for (uint64_t v = us; v > 1; v >>= 1)
+        ++e;
+    int index = LinearBuckets + (e - 4) * SubBuckets + static_cast<int>((us >> (e - 3)) & (SubBuckets - 1));
+    return index < BucketCount ? index : BucketCount - 1;
+}
+
+static double BucketMiddle(int index)
+{
+    if (index < LinearBuckets)
+        return index;
+    int e = (index - LinearBuckets) / SubBuckets + 4;
+    int sub = (index - LinearBuckets) % SubBuckets;
+    double width = static_cast<double>(uint64_t(1) << (e - 3));
+    return (SubBuckets + sub) * width + width / 2;
+}
+
+static int ThreadId()
+{
+    thread_local int id = s_nextThread.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+bool LatencyTrace::IsEnabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+void LatencyTrace::SetEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void LatencyTrace::Reset()
+{
+    for (Histogram & h : s_histograms)
+    {
+        for (auto & b : h.buckets)
+            b.store(0, std::memory_order_relaxed);
+        h.count.store(0, std::memory_order_relaxed);
+        h.max.store(0, std::memory_order_relaxed);
+    }
+    for (Event & e : s_events)
+        e.seq.store(0, std::memory_order_relaxed);
+    s_nextEvent.store(0, std::memory_order_relaxed);
+    s_pendingCommit.store(-1, std::memory_order_relaxed);
+}
+
+int64_t LatencyTrace::Now()
+{
+    static auto const origin = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - origin).count();
+}
+
+void LatencyTrace::Record(Stage stage, int64_t begin, int64_t end)
+{
+    if (!IsEnabled())
+        return;
+    int64_t duration = end > begin ? end - begin : 0;
+
+    Histogram & h = s_histograms[stage];
+    h.buckets[BucketOf(static_cast<uint64_t>(duration))].fetch_add(1, std::memory_order_relaxed);
+    h.count.fetch_add(1, std::memory_order_relaxed);
+    int64_t max = h.max.load(std::memory_order_relaxed);
+    while (duration > max && !h.max.compare_exchange_weak(max, duration, std::memory_order_relaxed))
+        ;
+
+    uint64_t index = s_nextEvent.fetch_add(1, std::memory_order_relaxed);
+    Event & e = s_events[index & (EventCapacity - 1)];
+    e.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    e.begin.store(begin, std::memory_order_relaxed);
+    e.duration.store(duration, std::memory_order_relaxed);
+    e.stage.store(stage, std::memory_order_relaxed);
+    e.thread.store(ThreadId(), std::memory_order_relaxed);
+    e.seq.store(index + 1, std::memory_order_release);
+}
+
+int64_t LatencyTrace::MarkInput()
+{
+    if (!IsEnabled())
+        return -1;
+    int64_t now = Now();
+    s_pendingCommit.store(now, std::memory_order_relaxed);
+    return now;
+}
+
+void LatencyTrace::MarkOutput(Stage stage)
+{
+    if (!IsEnabled())
+        return;
+    int64_t begin = s_pendingCommit.exchange(-1, std::memory_order_relaxed);
+    if (begin >= 0)
+        Record(stage, begin, Now());
+}
+
+void LatencyTrace::MarkOutput(Stage stage, int64_t inputStamp)
+{
+    if (inputStamp >= 0)
+        Record(stage, inputStamp, Now());
+}
+
+LatencyTrace::Summary LatencyTrace::GetSummary(Stage stage)
+{
+    Summary summary;
+    summary.count = s_histograms[stage].count.load(std::memory_order_relaxed);
+    summary.p50 = Percentile(stage, 0.5);
+    summary.p95 = Percentile(stage, 0.95);
+    summary.p99 = Percentile(stage, 0.99);
+    summary.max = static_cast<double>(s_histograms[stage].max.load(std::memory_order_relaxed));
+    return summary;
+}
+
+double LatencyTrace::Percentile(Stage stage, double q)
+{
+    Histogram & h = s_histograms[stage];
+    // sum the buckets rather than trust count, they are updated separately
+    uint64_t counts[BucketCount];
+    uint64_t total = 0;
+    for (int i = 0; i < BucketCount; ++i)
+    {
+        counts[i] = h.buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0)
+        return 0;
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total) + 0.5);
+    if (rank < 1)
+        rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < BucketCount; ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+            return BucketMiddle(i);
+    }
+    return BucketMiddle(BucketCount - 1);
+}
+
+char const * LatencyTrace::StageName(Stage stage)
+{
+    static char const * const names[] = {
+        "PlugIns", "DynamicRender", "Geometry", "Paint", "Commit", "InputToPaint", "InputToCommit"
+    };
+    return stage < StageCount ? names[stage] : "";
+}
+
+std::string LatencyTrace::ToChromeTrace()
+{
+    std::string json = "{\"traceEvents\":[";
+    uint64_t end = s_nextEvent.load(std::memory_order_acquire);
+    uint64_t begin = end > EventCapacity ? end - EventCapacity : 0;
+    bool first = true;
+    char buffer[160];
+    for (uint64_t index = begin; index < end; ++index)
+    {
+        Event & e = s_events[index & (EventCapacity - 1)];
+        if (e.seq.load(std::memory_order_acquire) != index + 1)
+            continue;
+        int64_t ts = e.begin.load(std::memory_order_relaxed);
+        int64_t dur = e.duration.load(std::memory_order_relaxed);
+        int stage = e.stage.load(std::memory_order_relaxed);
+        int thread = e.thread.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // overwritten while we read it
+        if (e.seq.load(std::memory_order_relaxed) != index + 1)
+            continue;
+        snprintf(buffer, sizeof(buffer),
+                 "%s{\"name\":\"%s\",\"cat\":\"ink\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+                 first ? "" : ",", StageName(static_cast<Stage>(stage)),
+                 static_cast<long long>(ts), static_cast<long long>(dur), thread);
+        json += buffer;
+        first = false;
+    }
+    json += "],\"displayTimeUnit\":\"ms\"}";
+    return json;
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,119 @@
+#ifndef LATENCYTRACE_H
+#define LATENCYTRACE_H
+
+#include "InkCanvas_global.h"
+
+#include <string>
+#include <cstdint>
+
+// namespace System.Diagnostics
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// Opt-in tracing of the inking pipeline. Each stage records its duration
+///  into a lock-free log-scaled histogram and into a bounded event ring,
+///  so percentiles can be queried from the host and the recent history
+///  dumped as Chrome trace JSON (chrome://tracing, Perfetto).
+/// When disabled, every entry point costs a single relaxed atomic load.
+/// </summary>
+class INKCANVAS_EXPORT LatencyTrace
+{
+public:
+    enum Stage
+    {
+        PlugIns,        // StylusPlugInCollection::FireRawStylusInput
+        DynamicRender,  // DynamicRenderer::RenderPackets
+        Geometry,       // StrokeRenderer::CalcGeometryAndBounds of an increment
+        Paint,          // DrawingVisual::paint
+        Commit,         // InkCollectionBehavior stroke commit
+        InputToPaint,   // packet arrival to the first paint of the visual showing it
+        InputToCommit,  // packet arrival of the last packet to stroke commit
+        StageCount
+    };
+
+    struct Summary
+    {
+        uint64_t count = 0;
+        // microseconds
+        double p50 = 0;
+        double p95 = 0;
+        double p99 = 0;
+        double max = 0;
+    };
+
+    class Scope
+    {
+    public:
+        Scope(Stage stage)
+            : stage_(stage)
+            , begin_(IsEnabled() ? Now() : -1)
+        {
+        }
+
+        ~Scope()
+        {
+            if (begin_ >= 0)
+                Record(stage_, begin_, Now());
+        }
+
+        Scope(Scope const &) = delete;
+        Scope & operator=(Scope const &) = delete;
+
+    private:
+        Stage stage_;
+        int64_t begin_;
+    };
+
+public:
+    static bool IsEnabled();
+
+    static void SetEnabled(bool enabled);
+
+    /// <summary>
+    /// Clears histograms, events and pending input marks
+    /// </summary>
+    static void Reset();
+
+    /// <summary>
+    /// Monotonic time in microseconds
+    /// </summary>
+    static int64_t Now();
+
+    static void Record(Stage stage, int64_t begin, int64_t end);
+
+    /// <summary>
+    /// Stamps the arrival of a packet and starts InputToCommit. Returns the
+    ///  stamp, -1 when disabled, which travels with the packet to the visual
+    ///  rendering it, see MarkOutput(Stage, int64_t)
+    /// </summary>
+    static int64_t MarkInput();
+
+    /// <summary>
+    /// Ends InputToCommit for the last marked packet, once per mark
+    /// </summary>
+    static void MarkOutput(Stage stage);
+
+    /// <summary>
+    /// Ends stage, e.g. InputToPaint, for the packet stamped inputStamp by MarkInput
+    /// </summary>
+    static void MarkOutput(Stage stage, int64_t inputStamp);
+
+    static Summary GetSummary(Stage stage);
+
+    /// <summary>
+    /// Value under which the fraction q of the recorded durations fall,
+    ///  resolved to the histogram bucket (within 12.5%)
+    /// </summary>
+    static double Percentile(Stage stage, double q);
+
+    static char const * StageName(Stage stage);
+
+    /// <summary>
+    /// Writes the events still in the ring as a Chrome trace JSON object
+    /// </summary>
+    static std::string ToChromeTrace();
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // LATENCYTRACE_H
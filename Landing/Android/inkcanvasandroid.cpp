@@ -4,6 +4,7 @@
 #include <Windows/point.h>
 #include <Windows/Ink/stroke.h>
 #include <Windows/Media/streamgeometry.h>
+#include <Windows/Media/pathbuffer.h>
 #include <Collections/Generic/array.h>
 #include <Internal/debug.h>
 
@@ -18,6 +19,8 @@ static jfieldID sf_PointF_X = nullptr;
 static jfieldID sf_PointF_Y = nullptr;
 static jmethodID sm_Matrix_getValues = nullptr;
 static jmethodID sm_RectF_set = nullptr;
+static jclass sc_Path = nullptr;
+static jmethodID sm_Path_copy = nullptr;
 
 INKCANVAS_END_NAMESPACE
 
@@ -62,6 +65,13 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*)
         return JNI_ERR;
     }
     sm_Matrix_getValues = env->GetMethodID(clazzMatrix, "getValues", "([F)V");
+    // Path copy constructor
+    sc_Path = env->FindClass("android/graphics/Path");
+    if (sc_Path == nullptr) {
+        return JNI_ERR;
+    }
+    sc_Path = reinterpret_cast<jclass>(env->NewGlobalRef(sc_Path));
+    sm_Path_copy = env->GetMethodID(sc_Path, "<init>", "(Landroid/graphics/Path;)V");
     // Stroke methods
     JNINativeMethod2 methods[] = {
         {"create", "([Landroid/graphics/PointF;[FFZZZ)J", reinterpret_cast<void*>(&createStroke)},
@@ -69,6 +79,7 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*)
         {"transform", "(JLandroid/graphics/Matrix;)V", reinterpret_cast<void*>(&transformStroke)},
         {"hitTest", "(JLandroid/graphics/PointF;)Z", reinterpret_cast<void*>(&hitTestStroke)},
         {"getGeometry", "(JLandroid/graphics/RectF;)Landroid/graphics/Path;", reinterpret_cast<void*>(&getStrokeGeometry)},
+        {"getGeometryBuffer", "(JLandroid/graphics/RectF;)[B", reinterpret_cast<void*>(&getStrokeGeometryBuffer)},
         {"free", "(J)V", reinterpret_cast<void*>(&freeStroke)},
     };
     jclass clazzStroke = env->FindClass("com/tal/inkcanvas/Stroke");
@@ -214,7 +225,32 @@ jobject getStrokeGeometry(JNIEnv * env, jobject, jlong stroke, jobject bounds)
         env->CallVoidMethod(bounds, sm_RectF_set, r.X(), r.Y(),
                             r.Right(), r.Bottom());
     }
-    return static_cast<jobject>(path);
+    if (path == nullptr)
+        return nullptr;
+    // A copy, the stroke's own path goes when GeometryCacheManager evicts it
+    return env->NewObject(sc_Path, sm_Path_copy, static_cast<jobject>(path));
+}
+
+jbyteArray getStrokeGeometryBuffer(JNIEnv * env, jobject, jlong stroke, jobject bounds)
+{
+    //Debug::Log("getStrokeGeometryBuffer");
+#undef F
+#define F nullptr
+    S(env, stroke)
+    // Cached on the stroke, arcs flattened: android.graphics.Path has none
+    PathBuffer const & buffer = s->GetGeometryBuffer();
+    if (bounds) {
+        Rect r = s->GetBounds();
+        env->CallVoidMethod(bounds, sm_RectF_set, r.X(), r.Y(),
+                            r.Right(), r.Bottom());
+    }
+    jbyteArray result = env->NewByteArray(static_cast<jsize>(buffer.ByteSize()));
+    if (result == nullptr)
+        return nullptr;
+    void * data = env->GetPrimitiveArrayCritical(result, nullptr);
+    buffer.Serialize(data);
+    env->ReleasePrimitiveArrayCritical(result, data, 0);
+    return result;
 }
 
 void freeStroke(JNIEnv *env, jobject, jlong stroke)
@@ -19,6 +19,8 @@ jboolean hitTestStroke(JNIEnv * env, jobject object, jlong stroke, jobject point
 
 jobject getStrokeGeometry(JNIEnv * env, jobject object, jlong stroke, jobject bounds);
 
+jbyteArray getStrokeGeometryBuffer(JNIEnv * env, jobject object, jlong stroke, jobject bounds);
+
 void freeStroke(JNIEnv * env, jobject object, jlong stroke);
 
 INKCANVAS_END_NAMESPACE
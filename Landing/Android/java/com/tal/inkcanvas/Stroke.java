@@ -37,6 +37,15 @@ public class Stroke
         return getGeometry(handle_, bounds);
     }
 
+    /**
+     * Outline packed as: int opCount, int coordCount, float coords[coordCount],
+     * byte ops[opCount], in native byte order. Ops are 0 moveTo (2 coords),
+     * 1 lineTo (2), 2 quadTo (4), 3 cubicTo (6), 5 close (0).
+     */
+    public byte[] getGeometryBuffer(final RectF bounds) {
+        return getGeometryBuffer(handle_, bounds);
+    }
+
     @Override
     public void finalize() {
         free(handle_);
@@ -54,5 +63,7 @@ public class Stroke
 
     private native Path getGeometry(long handle, RectF bounds);
 
+    private native byte[] getGeometryBuffer(long handle, RectF bounds);
+
     private native void free(long handle);
 }
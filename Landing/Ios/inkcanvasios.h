@@ -15,6 +15,7 @@
 - (void) transformWithMatrix:(CGAffineTransform) matrix;
 - (bool) hitTestWithPoint:(CGPoint) point;
 - (UIBezierPath*) getGeometryAndBounds:(CGRect*) bounds;
+- (NSData*) getGeometryBufferAndBounds:(CGRect*) bounds;
 - (void) dealloc;
 @end
 
@@ -42,7 +42,16 @@ void NS_Log(char const * t, char const * m, va_list args)
     void * path = StrokeWrapper_getGeometry(_stroke, b);
     if (bounds)
         *bounds = CGRectMake(b[0], b[1], b[2], b[3]);
-    return (UIBezierPath*) path;
+    return [(UIBezierPath*) path autorelease];
+}
+
+- (NSData*) getGeometryBufferAndBounds:(CGRect*) bounds {
+    double b[4];
+    long size = 0;
+    void * data = StrokeWrapper_getGeometryBuffer(_stroke, &size, b);
+    if (bounds)
+        *bounds = CGRectMake(b[0], b[1], b[2], b[3]);
+    return [NSData dataWithBytesNoCopy:data length:size freeWhenDone:YES];
 }
 
 - (void) dealloc {
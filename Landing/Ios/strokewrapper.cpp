@@ -1,11 +1,14 @@
 #include "strokewrapper.h"
+#include "uibezierpathwrapper.h"
 
 #include <Windows/Ink/drawingattributes.h>
 #include <Windows/Ink/stroke.h>
 #include <Windows/Input/styluspoint.h>
 #include <Windows/Input/styluspointcollection.h>
 #include <Windows/Media/streamgeometry.h>
+#include <Windows/Media/pathbuffer.h>
 
+#include <cstdlib>
 #include <memory>
 #include <vector>
 #include <mutex>
@@ -118,7 +121,8 @@ void *StrokeWrapper_getGeometry(long stroke, double bounds[])
 #define F nullptr
     S(stroke)
     s->GetGeometry();
-    void * path = static_cast<StreamGeometry*>(s->GetGeometry())->path();
+    // A copy, the stroke's own path goes when GeometryCacheManager evicts it
+    void * path = UIBezierPathWrapper_copy(static_cast<StreamGeometry*>(s->GetGeometry())->path());
     if (bounds) {
         Rect r = s->GetBounds();
         bounds[0] = r.Left(); bounds[1] = r.Top();
@@ -127,6 +131,28 @@ void *StrokeWrapper_getGeometry(long stroke, double bounds[])
     return path;
 }
 
+void *StrokeWrapper_getGeometryBuffer(long stroke, long * size, double bounds[])
+{
+    //log("getStrokeGeometryBuffer");
+#undef F
+#define F nullptr
+    S(stroke)
+    // Cached on the stroke, arcs flattened: bezier paths have none
+    PathBuffer const & buffer = s->GetGeometryBuffer();
+    if (bounds) {
+        Rect r = s->GetBounds();
+        bounds[0] = r.Left(); bounds[1] = r.Top();
+        bounds[2] = r.Width(); bounds[3] = r.Height();
+    }
+    void * data = malloc(buffer.ByteSize());
+    if (data == nullptr)
+        return nullptr;
+    buffer.Serialize(data);
+    if (size)
+        *size = static_cast<long>(buffer.ByteSize());
+    return data;
+}
+
 void StrokeWrapper_delete(long stroke)
 {
     //log("freeStroke");
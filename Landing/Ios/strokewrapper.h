@@ -10,7 +10,10 @@ long StrokeWrapper_new(int n, double x[], double y[], float pressures[],
 long StrokeWrapper_clone(long stroke);
 void StrokeWrapper_transform(long stroke, double matrix[6]);
 bool StrokeWrapper_hitTest(long stroke, double x, double y);
+// A copy of the outline path, owned by the caller
 void * StrokeWrapper_getGeometry(long stroke, double bounds[4]);
+// Packed outline, see PathBuffer for the layout; free() the result
+void * StrokeWrapper_getGeometryBuffer(long stroke, long * size, double bounds[4]);
 void StrokeWrapper_delete(long stroke);
 
 #ifdef __cplusplus
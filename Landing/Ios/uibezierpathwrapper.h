@@ -13,6 +13,8 @@ void UIBezierPathWrapper_addCurveToPoint(void * path, double x, double y, double
 void UIBezierPathWrapper_addArcWithCenter(void * path, double x, double y, double radius, double startAngle, double endAngle, int clockwise);
 void UIBezierPathWrapper_currentPoint(void * path, double * x, double * y);
 void UIBezierPathWrapper_closePath(void * path);
+// A copy owned by the caller, like new
+void * UIBezierPathWrapper_copy(void * path);
 void UIBezierPathWrapper_delete(void * path);
 
 #ifdef __cplusplus
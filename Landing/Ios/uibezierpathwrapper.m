@@ -51,6 +51,12 @@ void UIBezierPathWrapper_closePath(void * path)
     [aPath closePath];
 }
 
+void * UIBezierPathWrapper_copy(void * path)
+{
+    UIBezierPath *aPath = (id) path;
+    return [aPath copy];
+}
+
 void UIBezierPathWrapper_delete(void * path)
 {
     (void) path;
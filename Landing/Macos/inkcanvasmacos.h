@@ -12,6 +12,7 @@
 - (void) transformStroke:(long) stroke withMatrix:(CGAffineTransform) matrix;
 - (bool) hitTestStroke:(long) stroke withPoint:(CGPoint) point;
 - (NSBezierPath*) getStrokeGeometry:(long) stroke andBounds:(CGRect) bounds;
+- (NSData*) getStrokeGeometryBuffer:(long) stroke andBounds:(CGRect*) bounds;
 - (void) deleteStroke:(long) stroke;
 @end
 
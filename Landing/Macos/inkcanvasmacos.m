@@ -38,7 +38,16 @@ void NS_Log(char const * t, char const * m, va_list args)
     double b[4];
     void * path = StrokeWrapper_getGeometry(stroke, b);
     bounds = CGRectMake(b[0], b[1], b[2], b[3]);
-    return (NSBezierPath*) path;
+    return [(NSBezierPath*) path autorelease];
+}
+
+- (NSData*) getStrokeGeometryBuffer:(long) stroke andBounds:(CGRect*) bounds {
+    double b[4];
+    long size = 0;
+    void * data = StrokeWrapper_getGeometryBuffer(stroke, &size, b);
+    if (bounds)
+        *bounds = CGRectMake(b[0], b[1], b[2], b[3]);
+    return [NSData dataWithBytesNoCopy:data length:size freeWhenDone:YES];
 }
 
 - (void) deleteStroke:(long) stroke {
@@ -13,6 +13,8 @@ void NSBezierPathWrapper_addCurveToPoint(void * path, double x, double y, double
 void NSBezierPathWrapper_addArcWithCenter(void * path, double x, double y, double radius, double startAngle, double endAngle, int clockwise);
 void NSBezierPathWrapper_currentPoint(void * path, double * x, double * y);
 void NSBezierPathWrapper_closePath(void * path);
+// A copy owned by the caller, like new
+void * NSBezierPathWrapper_copy(void * path);
 void NSBezierPathWrapper_delete(void * path);
 
 #ifdef __cplusplus
@@ -51,6 +51,12 @@ void NSBezierPathWrapper_closePath(void * path)
     [aPath closePath];
 }
 
+void * NSBezierPathWrapper_copy(void * path)
+{
+    NSBezierPath *aPath = (id) path;
+    return [aPath copy];
+}
+
 void NSBezierPathWrapper_delete(void * path)
 {
 }
@@ -0,0 +1,39 @@
+QT =
+
+TEMPLATE = app
+TARGET = tst_incrementalbezier
+
+CONFIG += c++17 console testcase
+CONFIG -= app_bundle
+
+# The fitting code is built in, as for the core library
+DEFINES += INKCANVAS_CORE=1
+DEFINES += INKCANVAS_LIBRARY
+
+DEFINES += DEBUG_RENDERING_FEEDBACK=0
+DEFINES += DEBUG_LASSO_FEEDBACK=0
+DEFINES += DEBUG_OUTPUT=0
+DEFINES += OLD_ISF=0
+
+INKCANVAS = $$PWD/../..
+INCLUDEPATH += $$INKCANVAS
+
+SOURCES += \
+    tst_incrementalbezier.cpp \
+    $$INKCANVAS/eventargs.cpp \
+    $$INKCANVAS/guid.cpp \
+    $$INKCANVAS/single.cpp \
+    $$INKCANVAS/Internal/Ink/bezier.cpp \
+    $$INKCANVAS/Internal/Ink/cuspdata.cpp \
+    $$INKCANVAS/Internal/Ink/incrementalbezier.cpp \
+    $$INKCANVAS/Windows/vector.cpp \
+    $$INKCANVAS/Windows/Media/matrix.cpp \
+    $$INKCANVAS/Windows/Input/styluspoint.cpp \
+    $$INKCANVAS/Windows/Input/styluspointcollection.cpp \
+    $$INKCANVAS/Windows/Input/styluspointdescription.cpp \
+    $$INKCANVAS/Windows/Input/styluspointproperties.cpp \
+    $$INKCANVAS/Windows/Input/styluspointproperty.cpp \
+    $$INKCANVAS/Windows/Input/styluspointpropertyaccessor.cpp \
+    $$INKCANVAS/Windows/Input/styluspointpropertyids.cpp \
+    $$INKCANVAS/Windows/Input/styluspointpropertyinfo.cpp \
+    $$INKCANVAS/Windows/Input/styluspointpropertyinfodefaults.cpp
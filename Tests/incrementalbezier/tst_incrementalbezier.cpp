@@ -0,0 +1,154 @@
+#include "Internal/Ink/incrementalbezier.h"
+#include "Windows/Input/styluspointcollection.h"
+#include "Windows/Input/styluspoint.h"
+
+#include <cmath>
+#include <cstdio>
+
+// Pins IncrementalBezier::Fit() to Bezier::ConstructBezierState: fitting the
+// points of a stroke as they come in, packet by packet, gives the curve that
+// fitting the whole stroke so far gives, with and without a fitting error,
+// and also after the fits for the preview.
+
+INKCANVAS_USE_NAMESPACE
+
+static int failures = 0;
+
+static void Check(bool condition, char const * stroke, double fitError, int count, char const * what)
+{
+    if (!condition)
+    {
+        ++failures;
+        std::printf("FAIL: %s, fitting error %g, %d points: %s\n", stroke, fitError, count, what);
+    }
+}
+
+static bool SameCurve(Bezier & incremental, Bezier & whole)
+{
+    if (incremental.BezierPointCount() != whole.BezierPointCount())
+    {
+        return false;
+    }
+    for (int i = 0; i < whole.BezierPointCount(); ++i)
+    {
+        if (incremental.GetBezierPoint(i) != whole.GetBezierPoint(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void FitStroke(char const * name, StylusPointCollection const & stroke, double fitError, bool preview)
+{
+    IncrementalBezier incremental(fitError);
+    StylusPointCollection collected;
+    int packet = 1;
+    for (int i = 0; i < stroke.Count(); )
+    {
+        // packets of 1 to 7 points, as input delivers them
+        for (int end = std::min(i + packet, stroke.Count()); i < end; ++i)
+        {
+            collected.Add(StylusPoint(stroke[i]));
+        }
+        packet = packet % 7 + 1;
+
+        incremental.AddPoints(collected);
+        if (preview)
+        {
+            incremental.FitPreview();
+            // the committed stroke is fitted once, on its last packet
+            if (i < stroke.Count())
+            {
+                continue;
+            }
+        }
+        bool fitted = incremental.Fit();
+
+        Bezier whole;
+        bool constructed = whole.ConstructBezierState(collected, fitError);
+        Check(fitted == constructed, name, fitError, collected.Count(), "fit succeeds as ConstructBezierState");
+        if (fitted && constructed)
+        {
+            Check(SameCurve(incremental.GetBezier(), whole), name, fitError, collected.Count(),
+                  "control points equal those of ConstructBezierState");
+        }
+    }
+}
+
+static StylusPointCollection Spiral()
+{
+    StylusPointCollection points;
+    for (int i = 0; i < 400; ++i)
+    {
+        double t = i * 0.05;
+        points.Add(StylusPoint(200 + (10 + 4 * t) * std::cos(t), 200 + (10 + 4 * t) * std::sin(t)));
+    }
+    return points;
+}
+
+static StylusPointCollection ZigZag()
+{
+    // sharp turns, the curve splits at its cusps
+    StylusPointCollection points;
+    for (int i = 0; i < 300; ++i)
+    {
+        double x = i * 1.5;
+        double y = (i / 25) % 2 == 0 ? (i % 25) * 3.0 : (25 - i % 25) * 3.0;
+        points.Add(StylusPoint(x, y));
+    }
+    return points;
+}
+
+static StylusPointCollection Handwriting()
+{
+    // loops with jitter and repeated points, as a slow pen gives them
+    StylusPointCollection points;
+    for (int i = 0; i < 500; ++i)
+    {
+        double t = (i / 2) * 0.04;
+        double jitter = ((i * 7919) % 13 - 6) * 0.05;
+        points.Add(StylusPoint(50 + 30 * t + 20 * std::cos(3 * t) + jitter,
+                               100 + 25 * std::sin(3 * t) - jitter));
+    }
+    return points;
+}
+
+static StylusPointCollection Line()
+{
+    StylusPointCollection points;
+    for (int i = 0; i < 60; ++i)
+    {
+        points.Add(StylusPoint(10 + i * 2.0, 20 + i * 1.0));
+    }
+    return points;
+}
+
+int main()
+{
+    struct { char const * name; StylusPointCollection points; } strokes[] = {
+        { "spiral", Spiral() },
+        { "zigzag", ZigZag() },
+        { "handwriting", Handwriting() },
+        { "line", Line() },
+    };
+    // 0 is the default fitting error, a share of the stroke's length
+    double const fitErrors[] = { 0, 1, 5, 50 };
+
+    for (auto & stroke : strokes)
+    {
+        for (double fitError : fitErrors)
+        {
+            FitStroke(stroke.name, stroke.points, fitError, false);
+            FitStroke(stroke.name, stroke.points, fitError, true);
+        }
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%d failures\n", failures);
+        return 1;
+    }
+    std::printf("PASS\n");
+    return 0;
+}
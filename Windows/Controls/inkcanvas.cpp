@@ -67,6 +67,10 @@ InkCanvas::~InkCanvas()
     if (_feedbackAdorner && !_feedbackAdorner->VisualParent())
         delete _feedbackAdorner;
     SetDynamicRenderer(nullptr);
+#ifndef INKCANVAS_INK_SIGNALS
+    // The attributes keep their observers until told, unlike signal connections
+    DefaultDrawingAttributes()->RemoveObserver(this);
+#endif
 }
 
 /// <summary>
@@ -91,7 +95,11 @@ void InkCanvas::Initialize()
     // connect the attributes event handler after setting the stylus shape to avoid unnecessary
     //      calls into the RTI service
     //DefaultDrawingAttributes.AttributeChanged += new PropertyDataChangedEventHandler(DefaultDrawingAttributes_Changed);
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::connect(DefaultDrawingAttributes().get(), &DrawingAttributes::AttributeChanged, this, &InkCanvas::DefaultDrawingAttributes_Changed);
+#else
+    DefaultDrawingAttributes()->AddObserver(this);
+#endif
     //
     //
     // We must initialize this here (after adding DynamicRenderer* to Sytlus).
@@ -537,11 +545,20 @@ void InkCanvas::OnDefaultDrawingAttributesChanged(DependencyObject& d, Dependenc
     {
         //we didn't throw, change our backing value
         //oldValue.AttributeChanged -= new PropertyDataChangedEventHandler(inkCanvas.DefaultDrawingAttributes_Changed);
+#ifdef INKCANVAS_INK_SIGNALS
         QObject::disconnect(oldValue.get(), &DrawingAttributes::AttributeChanged, &inkCanvas, &InkCanvas::DefaultDrawingAttributes_Changed);
+#else
+        if (oldValue != nullptr)
+            oldValue->RemoveObserver(&inkCanvas);
+#endif
         DrawingAttributesReplacedEventArgs args(newValue, oldValue);
 
         //newValue.AttributeChanged += new PropertyDataChangedEventHandler(inkCanvas.DefaultDrawingAttributes_Changed);
+#ifdef INKCANVAS_INK_SIGNALS
         QObject::connect(newValue.get(), &DrawingAttributes::AttributeChanged, &inkCanvas, &InkCanvas::DefaultDrawingAttributes_Changed);
+#else
+        newValue->AddObserver(&inkCanvas);
+#endif
         inkCanvas.RaiseDefaultDrawingAttributeReplaced(args);
     }
 }
@@ -583,6 +600,21 @@ void InkCanvas::SetEraserShape(StylusShape * value)
     }
 }
 
+/// <summary>
+/// Gets or set if point erasing is committed once per stroke when the stylus is lifted
+/// </summary>
+/// <value>bool</value>
+bool InkCanvas::PointEraseBatchingEnabled()
+{
+    VerifyAccess();
+    return _pointEraseBatchingEnabled;
+}
+void InkCanvas::SetPointEraseBatchingEnabled(bool value)
+{
+    VerifyAccess();
+    _pointEraseBatchingEnabled = value;
+}
+
 #if STROKE_COLLECTION_EDIT_MASK
 void InkCanvas::SetEditMask(QPolygonF const & shape)
 {
@@ -685,6 +717,36 @@ void InkCanvas::SetResizeEnabled(bool value)
     }
 }
 
+/// <summary>
+/// Gets or set if selected strokes follow the mouse while being moved or resized
+/// </summary>
+/// <value>bool</value>
+bool InkCanvas::SelectionPreviewEnabled()
+{
+    VerifyAccess();
+    return GetInkCanvasSelection().PreviewEnabled();
+}
+void InkCanvas::SetSelectionPreviewEnabled(bool value)
+{
+    VerifyAccess();
+    GetInkCanvasSelection().SetPreviewEnabled(value);
+}
+
+/// <summary>
+/// Gets or set if a bitmap of the selected strokes is dragged instead of the strokes
+/// </summary>
+/// <value>bool</value>
+bool InkCanvas::SelectionBitmapProxyEnabled()
+{
+    VerifyAccess();
+    return GetInkCanvasSelection().BitmapProxyEnabled();
+}
+void InkCanvas::SetSelectionBitmapProxyEnabled(bool value)
+{
+    VerifyAccess();
+    GetInkCanvasSelection().SetBitmapProxyEnabled(value);
+}
+
 
 /// <summary>
 /// Read/Write access to the DefaultPacketDescription property.
@@ -2346,6 +2408,15 @@ void InkCanvas::DefaultDrawingAttributes_Changed(PropertyDataChangedEventArgs&)
     _editingCoordinator->InvalidateBehaviorCursor(_editingCoordinator->GetInkCollectionBehavior());
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+void InkCanvas::DrawingAttributes_AttributeChanged(DrawingAttributes &, PropertyDataChangedEventArgs & args)
+{
+    DefaultDrawingAttributes_Changed(args);
+}
+
+#endif
+
 /// <summary>
 /// Helper method used to set up the GetDynamicRenderer()->
 /// </summary>
@@ -11,6 +11,10 @@
 #include "Windows/Ink/applicationgesture.h"
 #include "Windows/Ink/stylusshape.h"
 
+#ifndef INKCANVAS_INK_SIGNALS
+#include "Internal/Ink/changeobservers.h"
+#endif
+
 class QBrush;
 class QMimeData;
 class QPolygonF;
@@ -52,6 +56,9 @@ class RoutedCommand {};
 class AdornerDecorator;
 
 class INKCANVAS_EXPORT InkCanvas : public FrameworkElement
+#ifndef INKCANVAS_INK_SIGNALS
+        , private DrawingAttributesObserver
+#endif
 {
     Q_OBJECT
 public:
@@ -482,6 +489,16 @@ public:
     StylusShape* EraserShape();
     void SetEraserShape(StylusShape * value);
 
+    /// <summary>
+    /// Gets or set if point erasing is committed once per stroke when the
+    /// stylus is lifted, instead of replacing the hit stroke on every move.
+    /// Until then the leftovers are only rendered. StrokeErasing is raised on
+    /// the first hit of each stroke and InkErased once per erase gesture.
+    /// </summary>
+    /// <value>bool</value>
+    bool PointEraseBatchingEnabled();
+    void SetPointEraseBatchingEnabled(bool value);
+
 #if STROKE_COLLECTION_EDIT_MASK
     void SetEditMask(QPolygonF const & shape);
 #endif
@@ -594,6 +611,24 @@ public:
     bool ResizeEnabled();
     void SetResizeEnabled(bool value);
 
+    /// <summary>
+    /// Gets or set if selected strokes follow the mouse while being moved or
+    /// resized. The strokes are rendered under a pending transform, their
+    /// points are only changed once the editing is committed.
+    /// </summary>
+    /// <value>bool</value>
+    bool SelectionPreviewEnabled();
+    void SetSelectionPreviewEnabled(bool value);
+
+    /// <summary>
+    /// Gets or set if selected strokes are rasterized once when moving or
+    /// resizing starts, and the image is dragged in the feedback adorner
+    /// instead of the strokes. Takes precedence over SelectionPreviewEnabled.
+    /// </summary>
+    /// <value>bool</value>
+    bool SelectionBitmapProxyEnabled();
+    void SetSelectionBitmapProxyEnabled(bool value);
+
 
     /// <summary>
     /// Read/Write access to the DefaultPacketDescription property.
@@ -1391,6 +1426,11 @@ private:
     /// the call. Also - there is no need for extra parameter validation.</remarks>
     void DefaultDrawingAttributes_Changed(PropertyDataChangedEventArgs& args);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    // DrawingAttributesObserver, for the DefaultDrawingAttributes
+    virtual void DrawingAttributes_AttributeChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & args) override;
+#endif
+
 public:
     /// <summary>
     /// Helper method used to set up the DynamicRenderer.
@@ -1623,6 +1663,11 @@ private:
     /// </summary>
     bool                        _useCustomCursor = false;
 
+    /// <summary>
+    /// Defers point erase commits to the end of the erase gesture
+    /// </summary>
+    bool                        _pointEraseBatchingEnabled = false;
+
 
     //
     // Rendering support.
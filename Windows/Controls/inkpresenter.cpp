@@ -33,6 +33,20 @@ InkPresenter::InkPresenter()
     //_constraintSize = Size.Empty;
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+InkPresenter::~InkPresenter()
+{
+    // Strokes keep their observers until told, unlike signal connections
+    SharedPointer<StrokeCollection> strokes = Strokes();
+    for (int i = 0; i < strokes->Count(); i++)
+    {
+        StopListeningOnStrokeEvents((*strokes)[i]);
+    }
+}
+
+#endif
+
 //#endregion Constructors
 
 //-------------------------------------------------------------------------------
@@ -68,6 +82,42 @@ void InkPresenter::DetachVisuals(Visual* visual)
     _renderer->DetachIncrementalRendering(visual);
 }
 
+/// <summary>
+/// SetPreviewTransform method
+/// </summary>
+/// <param name="strokes">The strokes to transform</param>
+/// <param name="transform">The pending transform</param>
+void InkPresenter::SetPreviewTransform(SharedPointer<StrokeCollection> strokes, Matrix const & transform)
+{
+    VerifyAccess();
+
+    _renderer->SetPreviewTransform(strokes, transform);
+}
+
+/// <summary>
+/// SetStrokesVisible method
+/// </summary>
+/// <param name="strokes">The strokes to show or hide</param>
+/// <param name="visible">Whether to show them</param>
+void InkPresenter::SetStrokesVisible(SharedPointer<StrokeCollection> strokes, bool visible)
+{
+    VerifyAccess();
+
+    _renderer->SetStrokesVisible(strokes, visible);
+}
+
+/// <summary>
+/// SetErasePreview method
+/// </summary>
+/// <param name="stroke">The stroke being erased</param>
+/// <param name="fragments">What is left of it so far</param>
+void InkPresenter::SetErasePreview(SharedPointer<Stroke> stroke, SharedPointer<StrokeCollection> fragments)
+{
+    VerifyAccess();
+
+    _renderer->SetErasePreview(stroke, fragments);
+}
+
 //#endregion Methods
 
 //-------------------------------------------------------------------------------
@@ -506,8 +556,12 @@ void InkPresenter::StartListeningOnStrokeEvents(SharedPointer<Stroke> stroke)
 {
     //System.Diagnostics.Debug::Assert(stroke != nullptr);
     //stroke.Invalidated += new EventHandler(OnStrokeChanged);
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::connect(stroke.get(), &Stroke::Invalidated,
                      this, &InkPresenter::OnStrokeChanged2);
+#else
+    stroke->AddObserver(this);
+#endif
 }
 
 /// <summary>
@@ -517,10 +571,23 @@ void InkPresenter::StopListeningOnStrokeEvents(SharedPointer<Stroke> stroke)
 {
     //System.Diagnostics.Debug::Assert(stroke != nullptr);
     //stroke.Invalidated -= new EventHandler(OnStrokeChanged);
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::disconnect(stroke.get(), &Stroke::Invalidated,
                      this, &InkPresenter::OnStrokeChanged2);
+#else
+    stroke->RemoveObserver(this);
+#endif
+}
+
+#ifndef INKCANVAS_INK_SIGNALS
+
+void InkPresenter::Stroke_Invalidated(Stroke &, EventArgs &)
+{
+    OnStrokeChanged2();
 }
 
+#endif
+
 /// <summary>
 /// Ensure the renderer root to be connected. The method is called from
 ///     AttachVisuals
@@ -7,6 +7,10 @@
 
 #include <utility>
 
+#ifndef INKCANVAS_INK_SIGNALS
+#include "Internal/Ink/changeobservers.h"
+#endif
+
 INKCANVAS_BEGIN_NAMESPACE
 
 class Renderer;
@@ -24,6 +28,9 @@ class AutomationPeer;
 /// Renders the specified StrokeCollection data.
 /// </summary>
 class InkPresenter : public Decorator
+#ifndef INKCANVAS_INK_SIGNALS
+        , private StrokeObserver
+#endif
 {
     Q_OBJECT
     //-------------------------------------------------------------------------------
@@ -39,6 +46,10 @@ public:
     /// </summary>
     InkPresenter();
 
+#ifndef INKCANVAS_INK_SIGNALS
+    virtual ~InkPresenter() override;
+#endif
+
     //#endregion Constructors
 
     //-------------------------------------------------------------------------------
@@ -62,6 +73,30 @@ public:
     /// <param name="visual">The stroke visual which needs to be detached</param>
     void DetachVisuals(Visual* visual);
 
+    /// <summary>
+    /// Renders the strokes under transform without changing their points,
+    /// identity resets. Used to preview selection moving and resizing.
+    /// </summary>
+    /// <param name="strokes">The strokes to transform</param>
+    /// <param name="transform">The pending transform</param>
+    void SetPreviewTransform(SharedPointer<StrokeCollection> strokes, Matrix const & transform);
+
+    /// <summary>
+    /// Shows or hides the strokes, used while a bitmap proxy of the selection
+    /// is dragged in their place
+    /// </summary>
+    /// <param name="strokes">The strokes to show or hide</param>
+    /// <param name="visible">Whether to show them</param>
+    void SetStrokesVisible(SharedPointer<StrokeCollection> strokes, bool visible);
+
+    /// <summary>
+    /// Renders fragments in place of stroke until the erasing is committed,
+    /// nullptr resets
+    /// </summary>
+    /// <param name="stroke">The stroke being erased</param>
+    /// <param name="fragments">What is left of it so far</param>
+    void SetErasePreview(SharedPointer<Stroke> stroke, SharedPointer<StrokeCollection> fragments);
+
     //#endregion Methods
 
     //-------------------------------------------------------------------------------
@@ -199,6 +234,11 @@ private:
     /// </summary>
     void OnStrokeChanged2();
 
+#ifndef INKCANVAS_INK_SIGNALS
+    // StrokeObserver, for the strokes presented
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & e) override;
+#endif
+
     /// <summary>
     /// Attaches event handlers to stroke events
     /// </summary>
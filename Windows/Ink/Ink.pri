@@ -35,6 +35,14 @@ SOURCES += \
         $$PWD/applicationgesture.cpp \
         $$PWD/gesturerecognitionresult.cpp \
 
+    inkcanvas_light_strokes {
+    HEADERS += \
+        $$PWD/inksignals.h \
+
+    SOURCES += \
+        $$PWD/inksignals.cpp \
+    }
+
     win32 {
     HEADERS += \
         $$PWD/gesturerecognizer.h \
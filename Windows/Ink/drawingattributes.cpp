@@ -40,11 +40,13 @@ DrawingAttributes::~DrawingAttributes()
 void DrawingAttributes::Initialize()
 {
     Debug::Assert(_extendedProperties != nullptr);
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //_extendedProperties->Changed +=
     //    new ExtendedPropertiesChangedEventHandler(this.ExtendedPropertiesChanged_EventForwarder);
     QObject::connect(_extendedProperties, &ExtendedPropertyCollection::Changed,
                      this, &DrawingAttributes::ExtendedPropertiesChanged_EventForwarder);
+#else
+    _extendedProperties->_drawingAttributes = this;
 #endif
 }
 
@@ -706,11 +708,15 @@ void DrawingAttributes::OnAttributeChanged(PropertyDataChangedEventArgs &e)
     //}
     //finally
     //{
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         //if ( this.AttributeChanged != null )
         //{
             emit AttributeChanged(e);
         //}
+#else
+        _observers.Notify([this, &e](DrawingAttributesObserver & observer) {
+            observer.DrawingAttributes_AttributeChanged(*this, e);
+        });
 #endif
     //}
 }
@@ -16,7 +16,12 @@
 
 #ifdef INKCANVAS_QT_SIGNALS
 #include <QColor>
+#endif
+
+#ifdef INKCANVAS_INK_SIGNALS
 #include <QObject>
+#else
+#include "Internal/Ink/changeobservers.h"
 #endif
 
 INKCANVAS_BEGIN_NAMESPACE
@@ -29,7 +34,7 @@ class ExtendedPropertyCollection;
 
 // namespace System.Windows.Ink
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 class INKCANVAS_EXPORT DrawingAttributes : public QObject
 {
     Q_OBJECT
@@ -49,10 +54,18 @@ public:
     /// <param name="extendedProperties"></param>
     DrawingAttributes(ExtendedPropertyCollection* extendedProperties);
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     virtual ~DrawingAttributes() override;
 #else
     virtual ~DrawingAttributes();
+
+    /// <summary>
+    /// Adds an observer of the attributes, in place of connecting to the
+    /// AttributeChanged and PropertyDataChanged signals
+    /// </summary>
+    void AddObserver(DrawingAttributesObserver * observer) { _observers.Add(observer); }
+
+    void RemoveObserver(DrawingAttributesObserver * observer) { _observers.Remove(observer); }
 #endif
 
 private:
@@ -213,7 +226,7 @@ public:
     //
     //------------------------------------------------------
 
-#ifdef INKCANVAS_QT
+#ifdef INKCANVAS_INK_SIGNALS
 
 signals:
     void PropertyChanged(PropertyChangedEventArgs & e);
@@ -285,7 +298,7 @@ public:
     /// <param name="args">The custom attributes that changed</param>
     void ExtendedPropertiesChanged_EventForwarder(ExtendedPropertiesChangedEventArgs& args);
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 
 signals:
     /// <summary>
@@ -304,7 +317,7 @@ protected:
     /// <param name="e">The change information for the DrawingAttribute that was modified</param>
     virtual void OnAttributeChanged(PropertyDataChangedEventArgs &e);
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 
 signals:
      /// <summary>
@@ -326,20 +339,22 @@ protected:
         //    throw new ArgumentNullException("e", SR.Get(SRID.EventArgIsNull));
         //}
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         //if (this.PropertyDataChanged != null)
         //{
             emit PropertyDataChanged(e);
         //}
 #else
-        (void) e;
+        _observers.Notify([this, &e](DrawingAttributesObserver & observer) {
+            observer.DrawingAttributes_PropertyDataChanged(*this, e);
+        });
 #endif
     }
 
 
     virtual void OnPropertyChanged(PropertyChangedEventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         //if ( _propertyChanged != null )
         {
             emit  _propertyChanged(e);
@@ -375,6 +390,9 @@ protected:
 
 private:
     ExtendedPropertyCollection* _extendedProperties;
+#ifndef INKCANVAS_INK_SIGNALS
+    ObserverList<DrawingAttributesObserver> _observers;
+#endif
 #ifndef INKCANVAS_CORE
     uint _v1RasterOperation = DrawingAttributeSerializer::RasterOperationDefaultV1;
     bool _heightChangedForCompatabity = false;
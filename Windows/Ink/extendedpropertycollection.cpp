@@ -1,5 +1,6 @@
 #include "Windows/Ink/extendedpropertycollection.h"
 #include "Windows/Ink/events.h"
+#include "Windows/Ink/drawingattributes.h"
 #include "Internal/debug.h"
 
 INKCANVAS_BEGIN_NAMESPACE
@@ -132,13 +133,11 @@ void ExtendedPropertyCollection::Remove(Guid const& id)
     //
     _optimisticIndex = -1;
 
-#ifdef INKCANVAS_QT
     // fire notification event
     //if (this.Changed != nullptr )
     {
-        Changed(eventArgs);
+        OnChanged(eventArgs);
     }
-#endif
 }
 
 /// <value>
@@ -198,16 +197,14 @@ void ExtendedPropertyCollection::Set(Guid const& attributeId, Variant const & va
             //this will raise events
             currentProperty.SetValue(value);
 
-#ifdef INKCANVAS_QT
             //raise change if anyone is listening
             //if (this.Changed != nullptr )
             {
                 ExtendedPropertiesChangedEventArgs eventArgs(
                         ExtendedProperty(currentProperty.Id(), oldValue), //old prop
                         currentProperty);                                   //new prop
-                Changed( eventArgs);
+                OnChanged( eventArgs);
             }
-#endif
             return;
         }
     }
@@ -229,12 +226,22 @@ void ExtendedPropertyCollection::Add(ExtendedProperty const & extendedProperty)
     Debug::Assert(!Contains(extendedProperty.Id()), "ExtendedProperty already belongs to the collection");
 
     _extendedProperties.Add(extendedProperty);
-#ifdef INKCANVAS_QT
     // fire notification event
     //if (this.Changed != nullptr )
     {
         ExtendedPropertiesChangedEventArgs eventArgs(ExtendedProperty::Empty, extendedProperty);
-        Changed(eventArgs);
+        OnChanged(eventArgs);
+    }
+}
+
+void ExtendedPropertyCollection::OnChanged(ExtendedPropertiesChangedEventArgs& e)
+{
+#ifdef INKCANVAS_INK_SIGNALS
+    emit Changed(e);
+#else
+    if (_drawingAttributes != nullptr)
+    {
+        _drawingAttributes->ExtendedPropertiesChanged_EventForwarder(e);
     }
 #endif
 }
@@ -5,20 +5,21 @@
 #include "Collections/Generic/list.h"
 #include "Collections/Generic/array.h"
 
-#ifdef INKCANVAS_QT
+#ifdef INKCANVAS_INK_SIGNALS
 #include <QObject>
 #endif
 
 INKCANVAS_BEGIN_NAMESPACE
 
 class ExtendedPropertiesChangedEventArgs;
+class DrawingAttributes;
 
 /// <summary>
 /// A collection of name/value pairs, called ExtendedProperties, can be stored
 /// in a collection to enable aggregate operations and assignment to Ink object
 /// model objects, such StrokeCollection and Stroke.
 /// </summary>
-#ifdef INKCANVAS_QT
+#ifdef INKCANVAS_INK_SIGNALS
 class ExtendedPropertyCollection : public QObject //does not implement ICollection, we don't need it
 {
     Q_OBJECT
@@ -134,7 +135,7 @@ public:
         return _extendedProperties.Count();
     }
 
-#ifdef INKCANVAS_QT
+#ifdef INKCANVAS_INK_SIGNALS
 signals:
     /// <summary>
     /// Event fired whenever a ExtendedProperty is modified in the collection
@@ -143,6 +144,12 @@ signals:
 #endif
 
 private:
+    /// <summary>
+    /// Raises Changed, or without signals, tells the DrawingAttributes backed by
+    /// this collection, the only listener
+    /// </summary>
+    void OnChanged(ExtendedPropertiesChangedEventArgs& e);
+
     /// <summary>
     /// private Add, we need to consider making this public in order to implement the generic ICollection
     /// </summary>
@@ -161,6 +168,11 @@ private:
 
     //used to optimize across Contains / Index calls
     mutable int _optimisticIndex = -1;
+
+#ifndef INKCANVAS_INK_SIGNALS
+    friend class DrawingAttributes;
+    DrawingAttributes * _drawingAttributes = nullptr;
+#endif
 };
 
 INKCANVAS_END_NAMESPACE
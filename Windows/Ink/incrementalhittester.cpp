@@ -648,7 +648,7 @@ StrokeInfo::StrokeInfo(SharedPointer<Stroke> stroke)
     //_stroke = stroke;
     _bounds = stroke->GetBounds();
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     // Start listening to the stroke events
     //_stroke.DrawingAttributesChanged += new PropertyDataChangedEventHandler(OnStrokeDrawingAttributesChanged);
     //_stroke.StylusPointsReplaced += new StylusPointsReplacedEventHandler(OnStylusPointsReplaced);
@@ -658,6 +658,8 @@ StrokeInfo::StrokeInfo(SharedPointer<Stroke> stroke)
     QObject::connect(_stroke.get(), &Stroke::StylusPointsReplaced, this, &StrokeInfo::OnStylusPointsReplaced);
     QObject::connect(_stroke->StylusPoints().get(), &StylusPointCollection::Changed, this, &StrokeInfo::OnStylusPointsChanged);
     QObject::connect(_stroke.get(), &Stroke::DrawingAttributesReplaced, this, &StrokeInfo::OnDrawingAttributesReplaced);
+#else
+    _stroke->AddObserver(this);
 #endif
 }
 
@@ -756,7 +758,7 @@ void StrokeInfo::Detach()
 {
     if (_stroke != nullptr)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         // Detach the event handlers
         //_stroke.DrawingAttributesChanged -= new PropertyDataChangedEventHandler(OnStrokeDrawingAttributesChanged);
         //_stroke.StylusPointsReplaced -= new StylusPointsReplacedEventHandler(OnStylusPointsReplaced);
@@ -766,6 +768,8 @@ void StrokeInfo::Detach()
         QObject::disconnect(_stroke.get(), &Stroke::StylusPointsReplaced, this, &StrokeInfo::OnStylusPointsReplaced);
         QObject::disconnect(_stroke->StylusPoints().get(), &StylusPointCollection::Changed, this, &StrokeInfo::OnStylusPointsChanged);
         QObject::disconnect(_stroke.get(), &Stroke::DrawingAttributesReplaced, this, &StrokeInfo::OnDrawingAttributesReplaced);
+#else
+        _stroke->RemoveObserver(this);
 #endif
         _stroke = nullptr;
     }
@@ -809,6 +813,30 @@ void StrokeInfo::OnDrawingAttributesReplaced(DrawingAttributesReplacedEventArgs&
     }
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+void StrokeInfo::Stroke_StylusPointsChanged(Stroke &)
+{
+    OnStylusPointsChanged();
+}
+
+void StrokeInfo::Stroke_StylusPointsReplaced(Stroke &, StylusPointsReplacedEventArgs & args)
+{
+    OnStylusPointsReplaced(args);
+}
+
+void StrokeInfo::Stroke_DrawingAttributesChanged(Stroke &, PropertyDataChangedEventArgs & args)
+{
+    OnStrokeDrawingAttributesChanged(args);
+}
+
+void StrokeInfo::Stroke_DrawingAttributesReplaced(Stroke &, DrawingAttributesReplacedEventArgs & args)
+{
+    OnDrawingAttributesReplaced(args);
+}
+
+#endif
+
 /// <summary>Implementation for the event handlers above</summary>
 void StrokeInfo::Invalidate()
 {
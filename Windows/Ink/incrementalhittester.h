@@ -285,6 +285,9 @@ public:
     /// <summary>Stroke that was hit</summary>
     SharedPointer<Stroke> HitStroke() { return _stroke; }
 
+    /// <summary>Where the stroke was hit, in findices of HitStroke</summary>
+    Array<StrokeIntersection> const & HitFragments() const { return _hitFragments; }
+
     /// <summary>
     ///
     /// </summary>
@@ -304,12 +307,12 @@ class DrawingAttributesReplacedEventArgs;
 /// A helper class associated with a stroke. Used for caching the stroke's
 /// bounding box, hit-testing results, and for keeping an eye on the stroke changes
 /// </summary>
-#ifdef INKCANVAS_QT
+#ifdef INKCANVAS_INK_SIGNALS
 class StrokeInfo : public QObject
 {
     Q_OBJECT
 #else
-class StrokeInfo
+class StrokeInfo final : private StrokeObserver
 {
 #endif
 public:
@@ -402,6 +405,14 @@ private:
 
     void OnDrawingAttributesReplaced(DrawingAttributesReplacedEventArgs& args);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    // StrokeObserver, forwarding to the handlers above
+    virtual void Stroke_StylusPointsChanged(Stroke & stroke) override;
+    virtual void Stroke_StylusPointsReplaced(Stroke & stroke, StylusPointsReplacedEventArgs & args) override;
+    virtual void Stroke_DrawingAttributesChanged(Stroke & stroke, PropertyDataChangedEventArgs & args) override;
+    virtual void Stroke_DrawingAttributesReplaced(Stroke & stroke, DrawingAttributesReplacedEventArgs & args) override;
+#endif
+
     /// <summary>Implementation for the event handlers above</summary>
     void Invalidate();
 
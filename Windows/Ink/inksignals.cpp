@@ -0,0 +1,104 @@
+#include "Windows/Ink/inksignals.h"
+
+#if defined INKCANVAS_QT_SIGNALS && !defined INKCANVAS_INK_SIGNALS
+
+#include "Windows/Ink/stroke.h"
+#include "Windows/Ink/drawingattributes.h"
+#include "Windows/Input/styluspointcollection.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+StrokeSignals::StrokeSignals(SharedPointer<Stroke> stroke, QObject * parent)
+    : QObject(parent)
+    , _stroke(stroke)
+{
+    _stroke->AddObserver(this);
+}
+
+StrokeSignals::~StrokeSignals()
+{
+    _stroke->RemoveObserver(this);
+}
+
+void StrokeSignals::Stroke_Invalidated(Stroke &, EventArgs & e)
+{
+    emit Invalidated(e);
+}
+
+void StrokeSignals::Stroke_DrawingAttributesChanged(Stroke &, PropertyDataChangedEventArgs & e)
+{
+    emit DrawingAttributesChanged(e);
+}
+
+void StrokeSignals::Stroke_DrawingAttributesReplaced(Stroke &, DrawingAttributesReplacedEventArgs & e)
+{
+    emit DrawingAttributesReplaced(e);
+}
+
+void StrokeSignals::Stroke_StylusPointsReplaced(Stroke &, StylusPointsReplacedEventArgs & e)
+{
+    emit StylusPointsReplaced(e);
+}
+
+void StrokeSignals::Stroke_StylusPointsChanged(Stroke &)
+{
+    emit StylusPointsChanged();
+}
+
+void StrokeSignals::Stroke_PropertyDataChanged(Stroke &, PropertyDataChangedEventArgs & e)
+{
+    emit PropertyDataChanged(e);
+}
+
+void StrokeSignals::Stroke_PropertyChanged(Stroke &, char const * propName)
+{
+    emit PropertyChanged(propName);
+}
+
+void StrokeSignals::Stroke_GeometryEvicted(Stroke &)
+{
+    emit GeometryEvicted();
+}
+
+DrawingAttributesSignals::DrawingAttributesSignals(SharedPointer<DrawingAttributes> drawingAttributes, QObject * parent)
+    : QObject(parent)
+    , _drawingAttributes(drawingAttributes)
+{
+    _drawingAttributes->AddObserver(this);
+}
+
+DrawingAttributesSignals::~DrawingAttributesSignals()
+{
+    _drawingAttributes->RemoveObserver(this);
+}
+
+void DrawingAttributesSignals::DrawingAttributes_AttributeChanged(DrawingAttributes &, PropertyDataChangedEventArgs & e)
+{
+    emit AttributeChanged(e);
+}
+
+void DrawingAttributesSignals::DrawingAttributes_PropertyDataChanged(DrawingAttributes &, PropertyDataChangedEventArgs & e)
+{
+    emit PropertyDataChanged(e);
+}
+
+StylusPointCollectionSignals::StylusPointCollectionSignals(SharedPointer<StylusPointCollection> stylusPoints, QObject * parent)
+    : QObject(parent)
+    , _stylusPoints(stylusPoints)
+{
+    _stylusPoints->AddObserver(this);
+}
+
+StylusPointCollectionSignals::~StylusPointCollectionSignals()
+{
+    _stylusPoints->RemoveObserver(this);
+}
+
+void StylusPointCollectionSignals::StylusPoints_Changed(StylusPointCollection &)
+{
+    emit Changed();
+}
+
+INKCANVAS_END_NAMESPACE
+
+#endif
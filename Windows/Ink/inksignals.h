@@ -0,0 +1,119 @@
+#ifndef WINDOWS_INK_INKSIGNALS_H
+#define WINDOWS_INK_INKSIGNALS_H
+
+#include "InkCanvas_global.h"
+
+#if defined INKCANVAS_QT_SIGNALS && !defined INKCANVAS_INK_SIGNALS
+
+#include "Internal/Ink/changeobservers.h"
+#include "sharedptr.h"
+
+#include <QObject>
+
+// namespace System.Windows.Ink
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// Raises the signals of a Stroke that is not a QObject (built with
+/// INKCANVAS_LIGHT_STROKES), for code written against those signals:
+/// connect to an adapter in place of the stroke. The adapter holds the
+/// stroke while it lives; create one only where signals are wanted, the
+/// strokes themselves stay without.
+/// </summary>
+class INKCANVAS_EXPORT StrokeSignals : public QObject, private StrokeObserver
+{
+    Q_OBJECT
+public:
+    StrokeSignals(SharedPointer<Stroke> stroke, QObject * parent = nullptr);
+
+    virtual ~StrokeSignals() override;
+
+    SharedPointer<Stroke> GetStroke() const { return _stroke; }
+
+signals:
+    void DrawingAttributesChanged(PropertyDataChangedEventArgs& e);
+
+    void DrawingAttributesReplaced(DrawingAttributesReplacedEventArgs& e);
+
+    void StylusPointsReplaced(StylusPointsReplacedEventArgs& e);
+
+    void StylusPointsChanged();
+
+    void PropertyDataChanged(PropertyDataChangedEventArgs& e);
+
+    void Invalidated(EventArgs& e);
+
+    void GeometryEvicted();
+
+    void PropertyChanged(QByteArray const & propName);
+
+private:
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & e) override;
+    virtual void Stroke_DrawingAttributesChanged(Stroke & stroke, PropertyDataChangedEventArgs & e) override;
+    virtual void Stroke_DrawingAttributesReplaced(Stroke & stroke, DrawingAttributesReplacedEventArgs & e) override;
+    virtual void Stroke_StylusPointsReplaced(Stroke & stroke, StylusPointsReplacedEventArgs & e) override;
+    virtual void Stroke_StylusPointsChanged(Stroke & stroke) override;
+    virtual void Stroke_PropertyDataChanged(Stroke & stroke, PropertyDataChangedEventArgs & e) override;
+    virtual void Stroke_PropertyChanged(Stroke & stroke, char const * propName) override;
+    virtual void Stroke_GeometryEvicted(Stroke & stroke) override;
+
+private:
+    SharedPointer<Stroke> _stroke;
+};
+
+/// <summary>
+/// Raises the signals of a DrawingAttributes that is not a QObject, see
+/// StrokeSignals
+/// </summary>
+class INKCANVAS_EXPORT DrawingAttributesSignals : public QObject, private DrawingAttributesObserver
+{
+    Q_OBJECT
+public:
+    DrawingAttributesSignals(SharedPointer<DrawingAttributes> drawingAttributes, QObject * parent = nullptr);
+
+    virtual ~DrawingAttributesSignals() override;
+
+    SharedPointer<DrawingAttributes> GetDrawingAttributes() const { return _drawingAttributes; }
+
+signals:
+    void AttributeChanged(PropertyDataChangedEventArgs& e);
+
+    void PropertyDataChanged(PropertyDataChangedEventArgs& e);
+
+private:
+    virtual void DrawingAttributes_AttributeChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & e) override;
+    virtual void DrawingAttributes_PropertyDataChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & e) override;
+
+private:
+    SharedPointer<DrawingAttributes> _drawingAttributes;
+};
+
+/// <summary>
+/// Raises the Changed signal of a StylusPointCollection that is not a
+/// QObject, see StrokeSignals
+/// </summary>
+class INKCANVAS_EXPORT StylusPointCollectionSignals : public QObject, private StylusPointCollectionObserver
+{
+    Q_OBJECT
+public:
+    StylusPointCollectionSignals(SharedPointer<StylusPointCollection> stylusPoints, QObject * parent = nullptr);
+
+    virtual ~StylusPointCollectionSignals() override;
+
+    SharedPointer<StylusPointCollection> GetStylusPoints() const { return _stylusPoints; }
+
+signals:
+    void Changed();
+
+private:
+    virtual void StylusPoints_Changed(StylusPointCollection & stylusPoints) override;
+
+private:
+    SharedPointer<StylusPointCollection> _stylusPoints;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif
+
+#endif // WINDOWS_INK_INKSIGNALS_H
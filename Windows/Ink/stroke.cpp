@@ -10,6 +10,10 @@
 #include "Internal/Ink/strokenodeiterator.h"
 #include "incrementalhittester.h"
 #include "Internal/Ink/strokerenderer.h"
+#include "Internal/Ink/strokegeometrycache.h"
+#include "Internal/Ink/geometrycachemanager.h"
+#include "Windows/Media/pathbuffer.h"
+#include "Windows/Media/pathbufferstreamgeometrycontext.h"
 #include "Windows/Ink/events.h"
 #include "Internal/finallyhelper.h"
 #include "Internal/debug.h"
@@ -18,6 +22,9 @@
 #include "Internal/Ink/InkSerializedFormat/strokecollectionserializer.h"
 #include "Internal/Ink/lasso.h"
 #include "Windows/Media/drawingcontext.h"
+#if DEBUG_RENDERING_FEEDBACK
+#include "Windows/Media/drawing.h"
+#endif
 #else
 class StrokeCollectionSerializer
 {
@@ -44,6 +51,12 @@ Stroke::Stroke()
 
 Stroke::~Stroke()
 {
+#ifndef INKCANVAS_INK_SIGNALS
+    if (_drawingAttributes != nullptr)
+        _drawingAttributes->RemoveObserver(this);
+    if (_stylusPoints != nullptr)
+        _stylusPoints->RemoveObserver(this);
+#endif
     delete _extendedProperties;
     SetGeometry(nullptr);
 }
@@ -95,13 +108,17 @@ void Stroke::Initialize()
     //_drawingAttributes.AttributeChanged += new PropertyDataChangedEventHandler(DrawingAttributes_Changed);
     //_stylusPoints.Changed += new EventHandler(StylusPoints_Changed);
     //_stylusPoints.CountGoingToZero += new CancelEventHandler(StylusPoints_CountGoingToZero);
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     QObject::connect(_drawingAttributes.get(), &DrawingAttributes::AttributeChanged,
                      this, &Stroke::DrawingAttributes_Changed);
     QObject::connect(_stylusPoints.get(), &StylusPointCollection::Changed,
                      this, &Stroke::StylusPoints_Changed);
     QObject::connect(_stylusPoints.get(), &StylusPointCollection::CountGoingToZero,
                      this, &Stroke::StylusPoints_CountGoingToZero);
+#else
+    if (_drawingAttributes != nullptr)
+        _drawingAttributes->AddObserver(this);
+    _stylusPoints->AddObserver(this);
 #endif
 }
 
@@ -176,6 +193,8 @@ void Stroke::Transform(Matrix const & transformMatrix, bool applyToStylusTip)
     {
         // we need to force a recaculation of the cached path geometry right after the
         // DrawingAttributes changed, beforet the events are raised.
+        _geometryCache.reset();
+        _cachedNodeArrays.reset();
         std::unique_ptr<Geometry> geometry;
         SetGeometry(geometry);
         // Set the cached bounds to empty, which will force a re-calculation of the _cachedBounds upon next GetBounds call.
@@ -239,6 +258,13 @@ SharedPointer<StylusPointCollection> Stroke::GetBezierStylusPoints()
         return _stylusPoints;
     }
 
+    // Smoothed already, by StrokeNodeIterator::GetIterator or SetFittedBezier
+    if (_cachedNodeArrays != nullptr && _drawingAttributes->FitToCurve()
+            && _cachedNodeArrays->Key().Matches(*_drawingAttributes))
+    {
+        return _cachedNodeArrays->StylusPoints();
+    }
+
     // Construct the Bezier approximation
     Bezier bezier;
     if (!bezier.ConstructBezierState(   *_stylusPoints,
@@ -248,6 +274,14 @@ SharedPointer<StylusPointCollection> Stroke::GetBezierStylusPoints()
         return _stylusPoints;
     }
 
+    return GetBezierStylusPoints(bezier);
+}
+
+/// <summary>
+/// Returns the StylusPoints smoothed along an already fitted bezier
+/// </summary>
+SharedPointer<StylusPointCollection> Stroke::GetBezierStylusPoints(Bezier & bezier)
+{
     double tolerance = 0.5;
     StylusShape * stylusShape = _drawingAttributes->GetStylusShape();
     if (nullptr != stylusShape)
@@ -268,6 +302,20 @@ SharedPointer<StylusPointCollection> Stroke::GetBezierStylusPoints()
     return GetInterpolatedStylusPoints(bezierPoints);
 }
 
+/// <summary>
+/// Takes bezier, a curve fitted to the StylusPoints while they were
+/// collected, as the stroke's FitToCurve smoothing
+/// </summary>
+void Stroke::SetFittedBezier(Bezier & bezier)
+{
+    if (!_drawingAttributes->FitToCurve() || _stylusPoints->Count() < 2)
+    {
+        return;
+    }
+
+    StrokeNodeIterator::CacheNodes(*this, GetBezierStylusPoints(bezier));
+}
+
 /// <summary>
 /// Interpolate packet / pressure data from _stylusPoints
 /// </summary>
@@ -481,10 +529,13 @@ bool Stroke::ContainsPropertyData(Guid const & propertyDataId) const
 /// <value>The drawing attributes associated with the current stroke.</value>
 void Stroke::SetDrawingAttributes(SharedPointer<DrawingAttributes> value)
 {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //_drawingAttributes.AttributeChanged -= new PropertyDataChangedEventHandler(DrawingAttributes_Changed);
     QObject::disconnect(_drawingAttributes.get(), &DrawingAttributes::AttributeChanged,
                      this, &Stroke::DrawingAttributes_Changed);
+#else
+    if (_drawingAttributes != nullptr)
+        _drawingAttributes->RemoveObserver(this);
 #endif
     DrawingAttributesReplacedEventArgs e(value, _drawingAttributes);
 
@@ -503,10 +554,12 @@ void Stroke::SetDrawingAttributes(SharedPointer<DrawingAttributes> value)
         _cachedBounds  = Rect::Empty();
     }
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //_drawingAttributes.AttributeChanged += new PropertyDataChangedEventHandler(DrawingAttributes_Changed);
     QObject::connect(_drawingAttributes.get(), &DrawingAttributes::AttributeChanged,
                      this, &Stroke::DrawingAttributes_Changed);
+#else
+    _drawingAttributes->AddObserver(this);
 #endif
     OnDrawingAttributesReplaced(e);
     OnInvalidated(EventArgs::Empty);
@@ -526,6 +579,8 @@ void Stroke::SetStylusPoints(SharedPointer<StylusPointCollection> value)
     }
 
     // Force a recaculation of the cached path geometry
+    _geometryCache.reset();
+    _cachedNodeArrays.reset();
     std::unique_ptr<Geometry> geometry;
     SetGeometry(geometry);
 
@@ -534,23 +589,28 @@ void Stroke::SetStylusPoints(SharedPointer<StylusPointCollection> value)
 
     StylusPointsReplacedEventArgs e(value, _stylusPoints);
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //_stylusPoints.Changed -= new EventHandler(StylusPoints_Changed);
     //_stylusPoints.CountGoingToZero -= new CancelEventHandler(StylusPoints_CountGoingToZero);
     QObject::disconnect(_stylusPoints.get(), &StylusPointCollection::Changed,
                      this, &Stroke::StylusPoints_Changed);
     QObject::disconnect(_stylusPoints.get(), &StylusPointCollection::CountGoingToZero,
                      this, &Stroke::StylusPoints_CountGoingToZero);
+#else
+    if (_stylusPoints != nullptr)
+        _stylusPoints->RemoveObserver(this);
 #endif
     _stylusPoints = value;
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //_stylusPoints.Changed += new EventHandler(StylusPoints_Changed);
     //_stylusPoints.CountGoingToZero += new CancelEventHandler(StylusPoints_CountGoingToZero);
     QObject::connect(_stylusPoints.get(), &StylusPointCollection::Changed,
                      this, &Stroke::StylusPoints_Changed);
     QObject::connect(_stylusPoints.get(), &StylusPointCollection::CountGoingToZero,
                      this, &Stroke::StylusPoints_CountGoingToZero);
+#else
+    _stylusPoints->AddObserver(this);
 #endif
 
     // fire notification
@@ -941,6 +1001,8 @@ void Stroke::DrawingAttributes_Changed(PropertyDataChangedEventArgs& e)
 /// <param name="e">event args</param>
 void Stroke::StylusPoints_Changed()
 {
+    _geometryCache.reset();
+    _cachedNodeArrays.reset();
     std::unique_ptr<Geometry> geometry;
     SetGeometry(geometry);
     _cachedBounds  = Rect::Empty();
@@ -960,6 +1022,30 @@ void Stroke::StylusPoints_CountGoingToZero(CancelEventArgs& e)
     //StylusPoints will raise the exception
 }
 
+#ifndef INKCANVAS_INK_SIGNALS
+
+void Stroke::StylusPoints_Changed(StylusPointCollection &)
+{
+    StylusPoints_Changed();
+}
+
+void Stroke::StylusPoints_CountGoingToZero(StylusPointCollection &, CancelEventArgs & e)
+{
+#ifdef INKCANVAS_QT_SIGNALS
+    StylusPoints_CountGoingToZero(e);
+#else
+    // Core builds never connected this, their strokes' points may be emptied
+    (void) e;
+#endif
+}
+
+void Stroke::DrawingAttributes_AttributeChanged(DrawingAttributes &, PropertyDataChangedEventArgs & e)
+{
+    DrawingAttributes_Changed(e);
+}
+
+#endif
+
 /// <summary>
 /// Computes the bounds of the stroke in the default rendering context
 /// </summary>
@@ -968,11 +1054,19 @@ Rect Stroke::GetBounds()
 {
     if (_cachedBounds.IsEmpty())
     {
-        StrokeNodeIterator iterator = StrokeNodeIterator::GetIterator(*this, *GetDrawingAttributes());
-        for (int i = 0; i < iterator.Count(); i++)
+        DrawingAttributes & drawingAttributes = *GetDrawingAttributes();
+        if (drawingAttributes.FitToCurve())
+        {
+            // The nodes are on the Bezier curve, keep them with the stroke
+            StrokeNodeIterator iterator = StrokeNodeIterator::GetIterator(*this, drawingAttributes);
+            for (int i = 0; i < iterator.Count(); i++)
+            {
+                _cachedBounds.Union(iterator.GetNodeBounds(i));
+            }
+        }
+        else
         {
-            StrokeNode strokeNode = iterator[i];
-            _cachedBounds.Union(strokeNode.GetBounds());
+            _cachedBounds = StrokeNodeIterator::GetBounds(*StylusPoints(), drawingAttributes);
         }
     }
 
@@ -1400,8 +1494,20 @@ Geometry * Stroke::GetGeometry(SharedPointer<DrawingAttributes> drawingAttribute
 {
     bool geometricallyEqual = DrawingAttributes::GeometricallyEqual(*drawingAttributes, *GetDrawingAttributes());
 
+    DropStaleGeometry();
+
     // need to recalculate the PathGemetry if the DA passed in is "geometrically" different from
     // this DA, or if the cached PathGeometry is dirty.
+    if (false == geometricallyEqual && _geometryCache)
+    {
+        // geometry for this DA variant (e.g. hollow passes) was built before
+        Geometry * geometry = _geometryCache->Find(*drawingAttributes);
+        if (geometry != nullptr)
+        {
+            return geometry;
+        }
+    }
+
     if (false == geometricallyEqual || (true == geometricallyEqual && nullptr == _cachedGeometry))
     {
         //Recalculate _pathGeometry;
@@ -1409,7 +1515,9 @@ Geometry * Stroke::GetGeometry(SharedPointer<DrawingAttributes> drawingAttribute
         Geometry * geometry = nullptr;
         Rect bounds;
 #if DEBUG_RENDERING_FEEDBACK
-        std::unique_ptr<DrawingContext> debugDC;
+        // no feedback is drawn, but the nodes draw into a real context
+        DrawingGroup debugDrawing;
+        std::unique_ptr<DrawingContext> debugDC(debugDrawing.Open());
 #endif
         StrokeRenderer::CalcGeometryAndBounds(iterator,
                                              *drawingAttributes,
@@ -1420,10 +1528,16 @@ Geometry * Stroke::GetGeometry(SharedPointer<DrawingAttributes> drawingAttribute
                                              geometry,
                                              bounds);
 
-        // return the calculated value directly. We cannot cache the result since the DA passed in
-        // is "geometrically" different from this.DrawingAttributes.
+        // The DA passed in is "geometrically" different from this.DrawingAttributes, keep the
+        // result aside keyed by its shape attributes, so that redrawing (e.g. selected strokes
+        // drawn as hollow) does not rebuild it.
         if (false == geometricallyEqual)
         {
+            if (!_geometryCache)
+            {
+                _geometryCache.reset(new StrokeGeometryCache(this));
+            }
+            _geometryCache->Add(*drawingAttributes, geometry);
             return geometry;
         }
 
@@ -1436,9 +1550,30 @@ Geometry * Stroke::GetGeometry(SharedPointer<DrawingAttributes> drawingAttribute
 
     // return a ref to our _cachedGeometry
     //System.Diagnostics.Debug.Assert(_cachedGeometry != null && _cachedGeometry.IsFrozen);
+    GeometryCacheManager::Touch(_geometryCacheEntry);
     return _cachedGeometry;
 }
 
+void Stroke::GetGeometry(StreamGeometryContext & context)
+{
+    SharedPointer<DrawingAttributes> drawingAttributes = GetDrawingAttributes();
+    StrokeNodeIterator iterator = StrokeNodeIterator::GetIterator(*this, *drawingAttributes);
+    Rect bounds;
+#if DEBUG_RENDERING_FEEDBACK
+    // no feedback is drawn, but the nodes draw into a real context
+    DrawingGroup debugDrawing;
+    std::unique_ptr<DrawingContext> debugDC(debugDrawing.Open());
+#endif
+    StrokeRenderer::CalcGeometryAndBounds(iterator,
+                                         *drawingAttributes,
+#if DEBUG_RENDERING_FEEDBACK
+                                         *debugDC, 0, false,
+#endif
+                                         false, //calc bounds
+                                         context,
+                                         bounds);
+}
+
 #ifndef INKCANVAS_CORE
 /// <summary>
 /// our code - StrokeVisual.OnRender and StrokeCollection.Draw - always calls this
@@ -1482,6 +1617,13 @@ void Stroke::SetIsSelected(bool value)
 
         // Raise Invalidated event. This will cause Renderer to repaint and call back DrawCore
         OnInvalidated(EventArgs::Empty);
+
+        // hollow geometries are only needed while selected, drop them after
+        // the renderer has replaced the drawings that referenced them
+        if (!_isSelected)
+        {
+            _geometryCache.reset();
+        }
     }
 }
 
@@ -1492,11 +1634,16 @@ void Stroke::SetGeometry(Geometry* geometry)
 {
     //System.Diagnostics.Debug.Assert(geometry != null);
     if (_cachedGeometry) {
-        delete _cachedGeometry;
+        DropGeometry(_cachedGeometry);
     }
     _cachedGeometry = geometry;
-    if (_cachedGeometry)
+    if (_cachedGeometry) {
         _cachedGeometry->tryTakeOwn(this);
+    } else {
+        // the outline is invalidated, the buffer packed from it too
+        _cachedGeometryBuffer.reset();
+    }
+    UpdateGeometryCacheEntry();
 }
 
 void Stroke::SetGeometry(std::unique_ptr<Geometry>& geometry)
@@ -1505,7 +1652,101 @@ void Stroke::SetGeometry(std::unique_ptr<Geometry>& geometry)
     cachedGeometry.swap(geometry);
     if (cachedGeometry)
         cachedGeometry->tryTakeOwn(this);
+    else
+        _cachedGeometryBuffer.reset();
     _cachedGeometry = cachedGeometry.release();
+    UpdateGeometryCacheEntry();
+}
+
+void Stroke::releaseGeometry()
+{
+    if (_cachedGeometry) {
+        _cachedGeometry->releaseOwn(this);
+        _cachedGeometry = nullptr;
+    }
+    UpdateGeometryCacheEntry();
+}
+
+PathBuffer const & Stroke::GetGeometryBuffer()
+{
+    DropStaleGeometry();
+    if (_cachedGeometryBuffer == nullptr)
+    {
+        std::unique_ptr<PathBuffer> buffer(new PathBuffer);
+        PathBufferStreamGeometryContext context(*buffer, true);
+        GetGeometry(context);
+        context.Close();
+        _cachedGeometryBuffer.swap(buffer);
+        UpdateGeometryCacheEntry();
+    }
+    else
+    {
+        GeometryCacheManager::Touch(_geometryCacheEntry);
+    }
+    return *_cachedGeometryBuffer;
+}
+
+void Stroke::DropStaleGeometry()
+{
+    // geometries built before the outline tolerance changed are stale
+    int outlineGeneration = StrokeRenderer::OutlineGeneration();
+    if (_outlineGeneration != outlineGeneration)
+    {
+        _outlineGeneration = outlineGeneration;
+        if (_geometryCache)
+        {
+            _geometryCache->Clear();
+        }
+        if (_cachedGeometry || _cachedGeometryBuffer)
+        {
+            SetGeometry(nullptr);
+        }
+    }
+}
+
+void Stroke::UpdateGeometryCacheEntry()
+{
+    size_t bytes = 0;
+    if (_cachedGeometry)
+        bytes += _cachedGeometry->ByteSize();
+    if (_cachedGeometryBuffer)
+        bytes += sizeof(PathBuffer) + _cachedGeometryBuffer->ByteSize();
+    if (_cachedNodeArrays)
+        bytes += _cachedNodeArrays->ByteSize();
+    if (bytes == 0)
+        GeometryCacheManager::Remove(_geometryCacheEntry);
+    else
+        GeometryCacheManager::Add(_geometryCacheEntry, this, bytes);
+}
+
+void Stroke::EvictGeometry()
+{
+    // Called by GeometryCacheManager, which has unlisted us already
+    _cachedGeometryBuffer.reset();
+    _cachedNodeArrays.reset();
+    if (_cachedGeometry) {
+        bool shown = _cachedGeometry->userCount() > 0;
+        DropGeometry(_cachedGeometry);
+        _cachedGeometry = nullptr;
+        // The drawings own it now, nothing is freed until they let it go
+        if (shown) {
+#ifdef INKCANVAS_INK_SIGNALS
+            emit GeometryEvicted();
+#else
+            _observers.Notify([this](StrokeObserver & observer) {
+                observer.Stroke_GeometryEvicted(*this);
+            });
+#endif
+        }
+    }
+}
+
+void Stroke::DropGeometry(Geometry * geometry)
+{
+    if (geometry->userCount() > 0)
+        geometry->releaseOwn(this);
+    else
+        delete geometry;
 }
 
 /// <summary>Hit tests all segments within a contour generated with shape and path</summary>
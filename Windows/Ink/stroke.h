@@ -5,6 +5,8 @@
 #include "Windows/Ink/drawingattributes.h"
 #include "Windows/Input/styluspointcollection.h"
 #include "Windows/Media/geometry.h"
+#include "Internal/Ink/geometrycachemanager.h"
+#include "Internal/Ink/changeobservers.h"
 #include "Collections/Generic/list.h"
 #include "sharedptr.h"
 
@@ -16,14 +18,19 @@
 INKCANVAS_BEGIN_NAMESPACE
 
 class Geometry;
+class StreamGeometryContext;
 class StrokeFIndices;
 class StrokeCollection;
 class StrokeIntersection;
 class Lasso;
+class Bezier;
 class EventArgs;
 class StylusPointsReplacedEventArgs;
 class DrawingAttributesReplacedEventArgs;
 class ExtendedPropertyCollection;
+class StrokeGeometryCache;
+class StrokeNodeArrays;
+class PathBuffer;
 
 #ifndef INKCANVAS_QT_SIGNALS
 class DrawingContext;
@@ -31,12 +38,13 @@ class DrawingContext;
 
 // namespace System.Windows.Ink
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 class INKCANVAS_EXPORT Stroke : public QObject, public EnableSharedFromThis<Stroke>
 {
     Q_OBJECT
 #else
-class INKCANVAS_EXPORT Stroke : public EnableSharedFromThis<Stroke>
+class INKCANVAS_EXPORT Stroke : public EnableSharedFromThis<Stroke>,
+        private StylusPointCollectionObserver, private DrawingAttributesObserver
 {
 #endif
 public:
@@ -89,6 +97,20 @@ public:
     /// <returns></returns>
     SharedPointer<StylusPointCollection> GetBezierStylusPoints();
 
+    /// <summary>
+    /// Returns the StylusPoints smoothed along bezier, a curve already fitted
+    /// to them, e.g. by an IncrementalBezier while the stroke was collected
+    /// </summary>
+    SharedPointer<StylusPointCollection> GetBezierStylusPoints(Bezier & bezier);
+
+    /// <summary>
+    /// Takes bezier, a curve fitted to the StylusPoints while they were
+    /// collected, as the stroke's FitToCurve smoothing, so the stroke is not
+    /// fitted again when it is first rendered or hit-tested. The smoothed
+    /// nodes are kept with the geometry and fitted again once evicted.
+    /// </summary>
+    void SetFittedBezier(Bezier & bezier);
+
     /// <summary>
     /// Interpolate packet / pressure data from _stylusPoints
     /// </summary>
@@ -165,7 +187,16 @@ public:
 
     void SetStylusPoints(SharedPointer<StylusPointCollection> value);
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifndef INKCANVAS_INK_SIGNALS
+
+    /// <summary>
+    /// Adds an observer of the stroke, in place of connecting to its signals
+    /// </summary>
+    void AddObserver(StrokeObserver * observer) { _observers.Add(observer); }
+
+    void RemoveObserver(StrokeObserver * observer) { _observers.Remove(observer); }
+
+#else
 
 signals:
     /// <summary>Event that is fired when a drawing attribute is changed.</summary>
@@ -201,6 +232,12 @@ signals:
     /// </summary>
     void Invalidated(EventArgs& e);
 
+    /// <summary>
+    /// GeometryCacheManager dropped the geometry while a drawing still showed
+    /// it. Renderer drops that drawing, to draw the stroke again when painted.
+    /// </summary>
+    void GeometryEvicted();
+
     /// <summary>
     /// INotifyPropertyChanged.PropertyChanged event, explicitly implemented
     /// </summary>
@@ -211,10 +248,12 @@ signals:
 protected:
     virtual void OnDrawingAttributesChanged(PropertyDataChangedEventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit DrawingAttributesChanged(e);
 #else
-        (void) e;
+        _observers.Notify([this, &e](StrokeObserver & observer) {
+            observer.Stroke_DrawingAttributesChanged(*this, e);
+        });
 #endif
     }
 
@@ -225,10 +264,12 @@ protected:
     /// <param name="e">DrawingAttributesReplacedEventArgs to raise the event with</param>
     virtual void OnDrawingAttributesReplaced(DrawingAttributesReplacedEventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit DrawingAttributesReplaced(e);
 #else
-        (void) e;
+        _observers.Notify([this, &e](StrokeObserver & observer) {
+            observer.Stroke_DrawingAttributesReplaced(*this, e);
+        });
 #endif
     }
 
@@ -238,10 +279,12 @@ protected:
     /// <param name="e">EventArgs</param>
     virtual void OnStylusPointsReplaced(StylusPointsReplacedEventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit StylusPointsReplaced(e);
 #else
-        (void) e;
+        _observers.Notify([this, &e](StrokeObserver & observer) {
+            observer.Stroke_StylusPointsReplaced(*this, e);
+        });
 #endif
     }
 
@@ -251,6 +294,11 @@ protected:
     /// <param name="e">EventArgs</param>
     virtual void OnStylusPointsChanged()
     {
+#ifndef INKCANVAS_INK_SIGNALS
+        _observers.Notify([this](StrokeObserver & observer) {
+            observer.Stroke_StylusPointsChanged(*this);
+        });
+#endif
     }
 
     /// <summary>
@@ -261,10 +309,12 @@ protected:
     /// to ensure that event listeners are notified</remarks>
     virtual void OnPropertyDataChanged(PropertyDataChangedEventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit PropertyDataChanged(e);
 #else
-        (void) e;
+        _observers.Notify([this, &e](StrokeObserver & observer) {
+            observer.Stroke_PropertyDataChanged(*this, e);
+        });
 #endif
     }
 
@@ -275,10 +325,12 @@ protected:
     /// </summary>
     virtual void OnInvalidated(EventArgs& e)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit Invalidated(e);
 #else
-        (void) e;
+        _observers.Notify([this, &e](StrokeObserver & observer) {
+            observer.Stroke_Invalidated(*this, e);
+        });
 #endif
     }
 
@@ -290,10 +342,12 @@ protected:
     /// instance, but every other INotifyPropertyChanged implementation follows this pattern.</remarks>
     virtual void OnPropertyChanged(char const * propName)
     {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
         emit PropertyChanged(propName);
 #else
-        (void) propName;
+        _observers.Notify([this, propName](StrokeObserver & observer) {
+            observer.Stroke_PropertyChanged(*this, propName);
+        });
 #endif
     }
 
@@ -369,6 +423,14 @@ private:
     /// <param name="e">event args</param>
     void StylusPoints_CountGoingToZero(CancelEventArgs& e);
 
+#ifndef INKCANVAS_INK_SIGNALS
+    // StylusPointCollectionObserver and DrawingAttributesObserver,
+    //  forwarding to the handlers above
+    virtual void StylusPoints_Changed(StylusPointCollection & stylusPoints) override;
+    virtual void StylusPoints_CountGoingToZero(StylusPointCollection & stylusPoints, CancelEventArgs & e) override;
+    virtual void DrawingAttributes_AttributeChanged(DrawingAttributes & drawingAttributes, PropertyDataChangedEventArgs & e) override;
+#endif
+
 public:
     /// <summary>
     /// Computes the bounds of the stroke in the default rendering context
@@ -513,6 +575,21 @@ public:
     /// <returns></returns>
     Geometry * GetGeometry(SharedPointer<DrawingAttributes> drawingAttributes);
 
+    /// <summary>
+    /// Renders the outline of the Stroke into context, without caching it.
+    /// For consumers that keep the figures in their own format, like a
+    /// PathBuffer or a ScanlineRasterizer. The context is not closed.
+    /// </summary>
+    /// <param name="context"></param>
+    void GetGeometry(StreamGeometryContext & context);
+
+    /// <summary>
+    /// The outline packed into a PathBuffer, endpoint arcs flattened to
+    /// Beziers, for landings that copy it out. Cached like the geometry:
+    /// built again after the stroke changes or GeometryCacheManager evicts it.
+    /// </summary>
+    PathBuffer const & GetGeometryBuffer();
+
 public:
 #ifndef INKCANVAS_CORE
     /// <summary>
@@ -548,6 +625,21 @@ public:
         _cachedBounds = newBounds;
     }
 
+    /// <summary>
+    /// Node arrays built for the stroke's drawing attributes, see
+    /// StrokeNodeIterator::GetIterator. Dropped with the geometry when the
+    /// stylus points change, counted and evicted with it by GeometryCacheManager.
+    /// </summary>
+    std::shared_ptr<StrokeNodeArrays> const & NodeArrays() const
+    {
+        return _cachedNodeArrays;
+    }
+    void SetNodeArrays(std::shared_ptr<StrokeNodeArrays> const & nodeArrays)
+    {
+        _cachedNodeArrays = nodeArrays;
+        UpdateGeometryCacheEntry();
+    }
+
     /// <summary>Hit tests all segments within a contour generated with shape and path</summary>
     /// <param name="shape"></param>
     /// <param name="path"></param>
@@ -579,13 +671,7 @@ public:
     static constexpr double TapHitRotation = 0;
 
 
-    void releaseGeometry()
-    {
-        if (_cachedGeometry) {
-            _cachedGeometry->releaseOwn(this);
-            _cachedGeometry = nullptr;
-        }
-    }
+    void releaseGeometry();
 
 /// <summary>
     /// Calculate the two transforms for two-pass rendering used to draw as hollow. The resulting outerTransform will make the
@@ -595,6 +681,31 @@ public:
 private:
     static void CalcHollowTransforms(SharedPointer<DrawingAttributes> originalDa, Matrix & innerTransform, Matrix & outerTransform);
 
+    /// <summary>
+    /// Drops the cached geometry and node arrays to keep GeometryCacheManager's
+    /// budget, the bounds stay and both are built again when asked for. Raises
+    /// GeometryEvicted if drawings still hold the geometry.
+    /// </summary>
+    void EvictGeometry();
+
+    /// <summary>
+    /// Deletes a geometry the stroke no longer caches, or leaves it to the
+    /// drawings that still show it
+    /// </summary>
+    void DropGeometry(Geometry * geometry);
+
+    /// <summary>
+    /// Drops the cached outlines when StrokeRenderer::OutlineGeneration moved on
+    /// </summary>
+    void DropStaleGeometry();
+
+    /// <summary>
+    /// Lists the cached outlines and node arrays with GeometryCacheManager at their size
+    /// </summary>
+    void UpdateGeometryCacheEntry();
+
+    friend class GeometryCacheManager;
+
 private:
         // Custom attributes associated with this stroke
     ExtendedPropertyCollection* _extendedProperties = nullptr;
@@ -606,12 +717,24 @@ private:
 
 private:
     Geometry * _cachedGeometry     = nullptr;
+    // the outline packed for landings, see GetGeometryBuffer
+    std::unique_ptr<PathBuffer> _cachedGeometryBuffer;
+    GeometryCacheManager::Entry _geometryCacheEntry;
+    // StrokeRenderer::OutlineGeneration the cached geometries were built under
+    int _outlineGeneration = 0;
+    // geometries for geometrically different DAs (hollow passes), built on demand
+    std::unique_ptr<StrokeGeometryCache> _geometryCache;
+    // compact stroke nodes for the stroke's own DA, shared with node iterators
+    std::shared_ptr<StrokeNodeArrays> _cachedNodeArrays;
     bool _isSelected         = false;
 #ifndef INKCANVAS_CORE
     bool _drawAsHollow       = false;
 #endif
     bool _cloneStylusPoints  = true;
     bool _delayRaiseInvalidated  = false;
+#ifndef INKCANVAS_INK_SIGNALS
+    ObserverList<StrokeObserver> _observers;
+#endif
     static constexpr double  HollowLineSize      = 1.0;
     Rect _cachedBounds       = Rect::Empty();
 
@@ -20,6 +20,7 @@
 #ifdef INKCANVAS_QT
 #include <QIODevice>
 #include <QBuffer>
+#include <QHash>
 #define shared_from_this sharedFromThis
 #endif
 
@@ -39,6 +40,9 @@ StrokeCollection::StrokeCollection(StrokeCollection const & o)
 
 StrokeCollection::~StrokeCollection()
 {
+#ifndef INKCANVAS_CORE
+    ResetRenderBatches();
+#endif
     delete _extendedProperties;
 #if STROKE_COLLECTION_MULTIPLE_LAYER
     for (QObject * c : children())
@@ -578,6 +582,9 @@ void StrokeCollection::AddWithoutEvent(SharedPointer<Stroke>stroke)
 {
     //Debug.Assert(stroke != null && IndexOf(stroke) == -1);
     this->Items().Add(stroke);
+#ifndef INKCANVAS_CORE
+    ResetRenderBatches();
+#endif
 }
 
 /// <summary>Collection of extended properties on this StrokeCollection</summary>
@@ -812,6 +819,12 @@ void StrokeCollection::RaiseStrokesChanged(SharedPointer<StrokeCollection> added
 {
     StrokeCollectionChangedEventArgs eventArgs(addedStrokes, removedStrokes, index);
 
+#ifndef INKCANVAS_CORE
+    // Keep render batches in sync before any handler gets a chance to draw
+    if (_renderBatches)
+        UpdateRenderBatches(addedStrokes, removedStrokes);
+#endif
+
      // Invoke OnPropertyChanged
     OnPropertyChanged(CountName);
     OnPropertyChanged(IndexerName);
@@ -1233,44 +1246,198 @@ INKCANVAS_BEGIN_NAMESPACE
 #ifndef INKCANVAS_CORE
 
 /// <summary>
-/// Render the StrokeCollection under the specified DrawingContext.
+/// Draw order of a StrokeCollection: highlighters grouped by color (drawn
+/// first, each group under one opacity layer), then solid strokes in z-order.
+/// Built on first Draw and then maintained incrementally, so a redraw does
+/// not have to regroup all strokes or clone highlighter attributes again.
 /// </summary>
-/// <param name="context"></param>
-void StrokeCollection::Draw(DrawingContext& context)
+class StrokeCollection::RenderBatches
 {
-    //if (nullptr == context)
-    //{
-    //    throw std::runtime_error("context");
-    //}
-
-    //The verification of UI context affinity is done in Stroke.Draw()
+public:
+    struct Highlighter
+    {
+        SharedPointer<Stroke> stroke;
+        // Alpha overridden, so colors only differ by alpha share a batch
+        QColor color;
+        // Cached StrokeRenderer::GetHighlighterAttributes, nullptr when stale
+        SharedPointer<DrawingAttributes> drawingAttributes;
+    };
 
     List<SharedPointer<Stroke>> solidStrokes;
-    QMap<QColor, List<SharedPointer<Stroke>>> highLighters;
+    QMap<QColor, List<Highlighter>> highLighters;
+    // Where each stroke lives, the key to its highlighter batch or invalid for solid
+    QHash<Stroke*, QColor> strokes;
 
-    for (int i = 0; i < Count(); i++)
+    void Add(SharedPointer<Stroke> stroke)
     {
-        SharedPointer<Stroke> stroke = (*this)[i];
-        List<SharedPointer<Stroke>> strokes;
         if (stroke->GetDrawingAttributes()->IsHighlighter())
         {
-            // It's very important to override the Alpha value so that Colors of the same RGB vale
-            // but different Alpha would be in the same list.
             QColor color = StrokeRenderer::GetHighlighterColor(stroke->GetDrawingAttributes()->Color());
-            //if (highLighters.TryGetValue(color, out strokes) == false)
-            //{
-            //    strokes = new List<Stroke>();
-            //    highLighters.Add(color, strokes);
-            //}
-            highLighters[color].Add(stroke);
+            highLighters[color].Add(Highlighter{stroke, color, nullptr});
+            strokes.insert(stroke.get(), color);
         }
         else
         {
             solidStrokes.Add(stroke);
+            strokes.insert(stroke.get(), QColor());
         }
     }
 
-    for (List<SharedPointer<Stroke>> strokes : highLighters.values())
+    void Remove(SharedPointer<Stroke> stroke)
+    {
+        QColor color = strokes.take(stroke.get());
+        if (!color.isValid())
+        {
+            solidStrokes.Remove(stroke);
+            return;
+        }
+        List<Highlighter> & batch = highLighters[color];
+        for (int i = 0; i < batch.Count(); ++i)
+        {
+            if (batch[i].stroke == stroke)
+            {
+                batch.RemoveAt(i);
+                break;
+            }
+        }
+        if (batch.Count() == 0)
+            highLighters.remove(color);
+    }
+};
+
+void StrokeCollection::BuildRenderBatches()
+{
+    _renderBatches = new RenderBatches;
+    for (int i = 0; i < Count(); i++)
+    {
+        SharedPointer<Stroke> stroke = (*this)[i];
+        _renderBatches->Add(stroke);
+#ifdef INKCANVAS_INK_SIGNALS
+        QObject::connect(stroke.get(), &Stroke::Invalidated,
+                         this, &StrokeCollection::OnStrokeInvalidated);
+#else
+        stroke->AddObserver(this);
+#endif
+    }
+}
+
+void StrokeCollection::ResetRenderBatches()
+{
+    if (_renderBatches == nullptr)
+        return;
+    for (Stroke * stroke : _renderBatches->strokes.keys())
+    {
+#ifdef INKCANVAS_INK_SIGNALS
+        QObject::disconnect(stroke, &Stroke::Invalidated,
+                            this, &StrokeCollection::OnStrokeInvalidated);
+#else
+        stroke->RemoveObserver(this);
+#endif
+    }
+    delete _renderBatches;
+    _renderBatches = nullptr;
+}
+
+void StrokeCollection::UpdateRenderBatches(SharedPointer<StrokeCollection> added, SharedPointer<StrokeCollection> removed)
+{
+    if (removed != nullptr)
+    {
+        for (SharedPointer<Stroke> stroke : *removed)
+        {
+            _renderBatches->Remove(stroke);
+#ifdef INKCANVAS_INK_SIGNALS
+            QObject::disconnect(stroke.get(), &Stroke::Invalidated,
+                                this, &StrokeCollection::OnStrokeInvalidated);
+#else
+            stroke->RemoveObserver(this);
+#endif
+        }
+    }
+    if (added == nullptr || added->Count() == 0)
+        return;
+    // Solid strokes are drawn in z-order, appending only works when the new
+    //  strokes end up at the tail; otherwise regroup on next Draw
+    int tail = Count() - added->Count();
+    for (int i = 0; i < added->Count(); ++i)
+    {
+        if ((*this)[tail + i] != (*added)[i])
+        {
+            ResetRenderBatches();
+            return;
+        }
+    }
+    for (SharedPointer<Stroke> stroke : *added)
+    {
+        _renderBatches->Add(stroke);
+#ifdef INKCANVAS_INK_SIGNALS
+        QObject::connect(stroke.get(), &Stroke::Invalidated,
+                         this, &StrokeCollection::OnStrokeInvalidated);
+#else
+        stroke->AddObserver(this);
+#endif
+    }
+}
+
+#ifdef INKCANVAS_INK_SIGNALS
+
+void StrokeCollection::OnStrokeInvalidated(EventArgs &)
+{
+    UpdateRenderBatch(static_cast<Stroke*>(sender()));
+}
+
+#else
+
+void StrokeCollection::Stroke_Invalidated(Stroke & stroke, EventArgs &)
+{
+    UpdateRenderBatch(&stroke);
+}
+
+#endif
+
+void StrokeCollection::UpdateRenderBatch(Stroke * stroke)
+{
+    if (_renderBatches == nullptr || !_renderBatches->strokes.contains(stroke))
+        return;
+    QColor color = _renderBatches->strokes.value(stroke);
+    SharedPointer<DrawingAttributes> da = stroke->GetDrawingAttributes();
+    if (da->IsHighlighter() != color.isValid()
+            || (color.isValid() && StrokeRenderer::GetHighlighterColor(da->Color()) != color))
+    {
+        // Moves between batches, a regroup keeps solid strokes in z-order
+        ResetRenderBatches();
+        return;
+    }
+    if (color.isValid())
+    {
+        for (RenderBatches::Highlighter & h : _renderBatches->highLighters[color])
+        {
+            if (h.stroke.get() == stroke)
+            {
+                h.drawingAttributes = nullptr;
+                break;
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Render the StrokeCollection under the specified DrawingContext.
+/// </summary>
+/// <param name="context"></param>
+/// <param name="drawAsHollow"></param>
+void StrokeCollection::Draw(DrawingContext& context, bool drawAsHollow)
+{
+    //if (nullptr == context)
+    //{
+    //    throw std::runtime_error("context");
+    //}
+
+    //The verification of UI context affinity is done in Stroke.Draw()
+
+    if (_renderBatches == nullptr)
+        BuildRenderBatches();
+
+    for (List<RenderBatches::Highlighter> & strokes : _renderBatches->highLighters)
     {
         context.PushOpacity(StrokeRenderer::HighlighterOpacity);
         FinallyHelper final([&context](){
@@ -1279,10 +1446,11 @@ void StrokeCollection::Draw(DrawingContext& context)
 
         //try
         {
-            for (SharedPointer<Stroke> stroke : strokes)
+            for (RenderBatches::Highlighter & h : strokes)
             {
-                stroke->DrawInternal(context, StrokeRenderer::GetHighlighterAttributes(*stroke, stroke->GetDrawingAttributes()),
-                                    false /*Don't draw selected stroke as hollow*/);
+                if (h.drawingAttributes == nullptr)
+                    h.drawingAttributes = StrokeRenderer::GetHighlighterAttributes(*h.stroke, h.stroke->GetDrawingAttributes());
+                h.stroke->DrawInternal(context, h.drawingAttributes, drawAsHollow);
             }
         }
         //finally
@@ -1291,9 +1459,9 @@ void StrokeCollection::Draw(DrawingContext& context)
         //}
     }
 
-    for (SharedPointer<Stroke> stroke : solidStrokes)
+    for (SharedPointer<Stroke> stroke : _renderBatches->solidStrokes)
     {
-        stroke->DrawInternal(context, stroke->GetDrawingAttributes(), false/*Don't draw selected stroke as hollow*/);
+        stroke->DrawInternal(context, stroke->GetDrawingAttributes(), drawAsHollow);
     }
 }
 
@@ -11,6 +11,10 @@
 #include "guid.h"
 #include "variant.h"
 
+#ifndef INKCANVAS_INK_SIGNALS
+#include "Internal/Ink/changeobservers.h"
+#endif
+
 // namespace System.Windows.Ink
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -23,6 +27,7 @@ class Stroke;
 class DrawingContext;
 class ExtendedPropertyCollection;
 class ErasingStroke;
+class EventArgs;
 
 #ifdef INKCANVAS_QT_SIGNALS
 #include <QObject>
@@ -30,6 +35,9 @@ class ErasingStroke;
 
 #ifdef INKCANVAS_QT_SIGNALS
 class INKCANVAS_EXPORT StrokeCollection : public QObject, public Collection<SharedPointer<Stroke>>, public EnableSharedFromThis<StrokeCollection>
+#ifndef INKCANVAS_INK_SIGNALS
+        , private StrokeObserver
+#endif
 {
     Q_OBJECT
 #else
@@ -401,7 +409,50 @@ public:
     /// Render the StrokeCollection under the specified DrawingContext.
     /// </summary>
     /// <param name="context"></param>
-    void Draw(DrawingContext& context);
+    /// <param name="drawAsHollow">draw the strokes hollow, the way selected strokes are shown</param>
+    void Draw(DrawingContext& context, bool drawAsHollow = false);
+
+#ifndef INKCANVAS_CORE
+private:
+    /// <summary>
+    /// Solid strokes and highlighter strokes grouped by color, kept up to date
+    /// with collection and stroke changes once Draw has been called
+    /// </summary>
+    class RenderBatches;
+
+    /// <summary>
+    /// Groups the strokes into render batches and starts listening on them
+    /// </summary>
+    void BuildRenderBatches();
+
+    /// <summary>
+    /// Drops the render batches, they are rebuilt on next Draw
+    /// </summary>
+    void ResetRenderBatches();
+
+    /// <summary>
+    /// Applies a StrokesChanged to the render batches
+    /// </summary>
+    void UpdateRenderBatches(SharedPointer<StrokeCollection> added, SharedPointer<StrokeCollection> removed);
+
+#ifdef INKCANVAS_INK_SIGNALS
+    /// <summary>
+    /// Stroke Invalidated event handler, see UpdateRenderBatch
+    /// </summary>
+    void OnStrokeInvalidated(EventArgs& e);
+#else
+    // StrokeObserver, for the strokes in the render batches
+    virtual void Stroke_Invalidated(Stroke & stroke, EventArgs & e) override;
+#endif
+
+    /// <summary>
+    /// Moves an invalidated stroke between batches when its IsHighlighter or
+    /// highlighter color changed
+    /// </summary>
+    void UpdateRenderBatch(Stroke * stroke);
+
+public:
+#endif
 
     //#endregion
 
@@ -439,6 +490,9 @@ private:
     QPolygonF maskShape_;
     ErasingStroke * mask_ = nullptr;
 #endif
+#ifndef INKCANVAS_CORE
+    RenderBatches * _renderBatches = nullptr;
+#endif
 
     /// <summary>
     /// Constants for the PropertyChanged event
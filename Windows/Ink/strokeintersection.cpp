@@ -2,6 +2,8 @@
 
 #include <Collections/Generic/list.h>
 
+#include <algorithm>
+
 INKCANVAS_BEGIN_NAMESPACE
 
 StrokeIntersection StrokeIntersection::s_empty(AfterLast, AfterLast, BeforeFirst, BeforeFirst);
@@ -106,4 +108,43 @@ List<StrokeIntersection> StrokeIntersection::GetMaskedHitSegments(List<StrokeInt
     return result;
 }
 
+/// <summary>
+/// Merges the hit-segments of intersections into the sorted, disjoint segments
+/// </summary>
+bool StrokeIntersection::UnionHitSegments(List<StrokeIntersection> & segments,
+                                          Array<StrokeIntersection> const & intersections)
+{
+    List<StrokeIntersection> previous = segments;
+    for (StrokeIntersection const & si : intersections) {
+        if (!si.HitSegment().IsEmpty())
+            segments.Add(si);
+    }
+    if (segments.Count() == previous.Count())
+        return false;
+
+    std::sort(segments.begin(), segments.end(), [](StrokeIntersection const & l, StrokeIntersection const & r) {
+        return l.HitBegin() < r.HitBegin();
+    });
+
+    List<StrokeIntersection> merged;
+    for (StrokeIntersection const & si : segments) {
+        if (merged.Count() > 0 && merged.back().HitEnd() >= si.HitBegin()) {
+            if (si.HitEnd() > merged.back().HitEnd())
+                merged.back().SetHitEnd(si.HitEnd());
+        } else {
+            merged.Add(si);
+        }
+    }
+    segments = merged;
+
+    // Mostly the same parts of the stroke are hit again while the eraser rests
+    if (merged.Count() != previous.Count())
+        return true;
+    for (int i = 0; i < merged.Count(); ++i) {
+        if (merged[i].HitBegin() != previous[i].HitBegin() || merged[i].HitEnd() != previous[i].HitEnd())
+            return true;
+    }
+    return false;
+}
+
 INKCANVAS_END_NAMESPACE
@@ -202,6 +202,15 @@ public:
     static List<StrokeIntersection> GetMaskedHitSegments(List<StrokeIntersection> & intersections,
                                                         Array<StrokeIntersection> const & clip);
 
+    /// <summary>
+    /// Merges the hit-segments of intersections into segments, which is kept
+    /// sorted and free of overlaps, so the union of several erase increments
+    /// can be handed to Stroke.Erase at once. In-segments are not preserved.
+    /// </summary>
+    /// <returns>true if the union grew</returns>
+    static bool UnionHitSegments(List<StrokeIntersection> & segments,
+                                 Array<StrokeIntersection> const & intersections);
+
 private:
     StrokeFIndices _hitSegment;
     StrokeFIndices _inSegment;
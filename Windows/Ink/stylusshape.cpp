@@ -101,6 +101,24 @@ Array<Vector> StylusShape::GetVerticesAsVectors()
     return vertices;
 }
 
+Rect const & StylusShape::VerticesBounds()
+{
+    if (_verticesBounds.IsEmpty())
+    {
+        Array<Vector> vertices = GetVerticesAsVectors();
+        int i;
+        for (i = 0; (i + 1) < vertices.Length(); i += 2)
+        {
+            _verticesBounds.Union(Rect((Point)vertices[i], (Point)vertices[i + 1]));
+        }
+        if (i < vertices.Length())
+        {
+            _verticesBounds.Union((Point)vertices[i]);
+        }
+    }
+    return _verticesBounds;
+}
+
 Rect StylusShape::BoundingBox()
 {
     Rect bbox = Rect::Empty();
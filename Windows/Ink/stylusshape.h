@@ -6,6 +6,7 @@
 #include "Windows/Ink/stylustip.h"
 #include "Collections/Generic/array.h"
 #include "Windows/Media/matrix.h"
+#include "Windows/rect.h"
 
 // namespace System.Windows.Ink
 INKCANVAS_BEGIN_NAMESPACE
@@ -28,6 +29,7 @@ private:
     Array<Point>   m_vertices;
     StylusTip m_tip;
     Matrix    _transform;
+    Rect      _verticesBounds = Rect::Empty();
 
 
 public:
@@ -64,6 +66,11 @@ public:
     /// <returns></returns>
     Array<Vector> GetVerticesAsVectors();
 
+    /// <summary>
+    /// Bounds of GetVerticesAsVectors(), which is the extent of a stroke node
+    /// around its position at pressure factor 1. Computed on first use.
+    /// </summary>
+    Rect const & VerticesBounds();
 
     /// <summary>
     /// This is the transform on the StylusShape
@@ -76,6 +83,7 @@ public:
     {
         //System.Diagnostics.Debug.Assert(value.HasInverse);
         _transform = value;
+        _verticesBounds = Rect::Empty();
     }
 
     ///<summary>
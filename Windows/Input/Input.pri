@@ -6,6 +6,7 @@ HEADERS += \
     $$PWD/styluspointdescription.h \
     $$PWD/styluspointproperties.h \
     $$PWD/styluspointproperty.h \
+    $$PWD/styluspointpropertyaccessor.h \
     $$PWD/styluspointpropertyids.h \
     $$PWD/styluspointpropertyinfo.h \
     $$PWD/styluspointpropertyinfodefaults.h
@@ -16,6 +17,7 @@ SOURCES += \
     $$PWD/styluspointdescription.cpp \
     $$PWD/styluspointproperties.cpp \
     $$PWD/styluspointproperty.cpp \
+    $$PWD/styluspointpropertyaccessor.cpp \
     $$PWD/styluspointpropertyids.cpp \
     $$PWD/styluspointpropertyinfo.cpp \
     $$PWD/styluspointpropertyinfodefaults.cpp
@@ -33,6 +35,7 @@ HEADERS += \
     $$PWD/querycursoreventargs.h \
     $$PWD/stylusdevice.h \
     $$PWD/styluseventargs.h \
+    $$PWD/stylusinputrecorder.h \
 
 SOURCES += \
     $$PWD/inputdevice.cpp \
@@ -45,5 +48,6 @@ SOURCES += \
     $$PWD/querycursoreventargs.cpp \
     $$PWD/stylusdevice.cpp \
     $$PWD/styluseventargs.cpp \
+    $$PWD/stylusinputrecorder.cpp \
 
 }
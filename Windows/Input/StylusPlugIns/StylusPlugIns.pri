@@ -3,11 +3,13 @@ HEADERS += \
     $$PWD/rawstylusactions.h \
     $$PWD/rawstylusinput.h \
     $$PWD/stylusplugin.h \
-    $$PWD/stylusplugincollection.h
+    $$PWD/stylusplugincollection.h \
+    $$PWD/styluspointdecimator.h
 
 SOURCES += \
     $$PWD/dynamicrenderer.cpp \
     $$PWD/rawstylusactions.cpp \
     $$PWD/rawstylusinput.cpp \
     $$PWD/stylusplugin.cpp \
-    $$PWD/stylusplugincollection.cpp
+    $$PWD/stylusplugincollection.cpp \
+    $$PWD/styluspointdecimator.cpp
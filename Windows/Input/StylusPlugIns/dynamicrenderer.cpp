@@ -4,9 +4,15 @@
 #include "Internal/Ink/strokenodeoperations.h"
 #include "Internal/Ink/strokerenderer.h"
 #include "Internal/Ink/pencursormanager.h"
+#include "Internal/Ink/inputpredictor.h"
+#include "Internal/Ink/incrementalbezier.h"
+#include "Windows/Ink/stroke.h"
 #include "Windows/Ink/drawingattributes.h"
 #include "Windows/Media/geometry.h"
 #include "Windows/Media/drawingcontext.h"
+#if DEBUG_RENDERING_FEEDBACK
+#include "Windows/Media/drawing.h"
+#endif
 #include "Windows/Media/drawingvisual.h"
 #include "Windows/Media/containervisual.h"
 #include "Windows/Input/stylusdevice.h"
@@ -15,6 +21,7 @@
 #include "Windows/dispatcher.h"
 #include "Internal/finallyhelper.h"
 #include "Internal/debug.h"
+#include "Internal/latencytrace.h"
 
 #include <QBrush>
 #include <QThread>
@@ -108,6 +115,9 @@ class DynamicRenderer::StrokeInfo
     std::map<int, StrokeNodeIterator> _strokeNodeIterator;
     double _opacity;
     DynamicRendererHostVisual*   _strokeHV = nullptr;  // App thread rendering HostVisual
+    std::map<int, InputPredictor> _predictors; // latency hiding, per touch id
+    std::map<int, SharedPointer<Stroke>> _smoothedStrokes; // FitToCurve, per touch id
+    std::map<int, IncrementalBezier> _bezierFits;
 
 public:
     StrokeInfo(SharedPointer<DrawingAttributes> drawingAttributes, int stylusDeviceId, int startTimestamp, DynamicRendererHostVisual* hostVisual)
@@ -202,6 +212,10 @@ public:
         if (_strokeCV == nullptr)
             return;
         _strokeNodeIterator.erase(id);
+        _predictors.erase(id);
+        _smoothedStrokes.erase(id);
+        _bezierFits.erase(id);
+        RemovePrediction(id);
         List<Visual*> toRemove;
         for (Visual* v : _strokeCV->Children()) {
             if (v->data(1000) == id) {
@@ -213,6 +227,82 @@ public:
             delete v;
         }
     }
+    InputPredictor& GetPredictor(int id)
+    {
+        return _predictors[id];
+    }
+    // The visual showing id, the one a smoothed stroke is drawn again into
+    DrawingVisual* FindVisual(int id)
+    {
+        if (_strokeCV == nullptr)
+            return nullptr;
+        for (Visual* v : _strokeCV->Children()) {
+            if (v->data(1000) == id)
+                return static_cast<DrawingVisual*>(v);
+        }
+        return nullptr;
+    }
+    // FitToCurve strokes are shown smoothed: the nodes of id become those of
+    //  its points so far along their curve, fitted again as points come in
+    void SmoothStroke(int id, SharedPointer<StylusPointCollection> stylusPoints)
+    {
+        auto i = _smoothedStrokes.find(id);
+        if (i == _smoothedStrokes.end()) {
+            SharedPointer<Stroke> stroke(new Stroke(stylusPoints->Clone(), _drawingAttributes));
+            i = _smoothedStrokes.emplace(id, stroke).first;
+            _bezierFits.emplace(id, _drawingAttributes->FittingError());
+        } else {
+            i->second->StylusPoints()->Add(*stylusPoints);
+        }
+        Stroke & stroke = *i->second;
+        IncrementalBezier & bezier = _bezierFits.at(id);
+        bezier.AddPoints(*stroke.StylusPoints());
+        SharedPointer<StylusPointCollection> points = bezier.FitPreview()
+                ? stroke.GetBezierStylusPoints(bezier.GetBezier()) : stroke.StylusPoints();
+        GetStrokeNodeIterator(id);
+        SetStrokeNodeIterator(id, StrokeNodeIterator::GetIterator(points, *_drawingAttributes));
+    }
+    void ResetPredictors()
+    {
+        for (auto & e : _predictors)
+            e.second.Reset();
+    }
+    // The visual showing the predicted tail of id, nullptr if there is none yet
+    DrawingVisual* FindPrediction(int id)
+    {
+        if (_strokeCV == nullptr)
+            return nullptr;
+        for (Visual* v : _strokeCV->Children()) {
+            if (v->data(1001) == id)
+                return static_cast<DrawingVisual*>(v);
+        }
+        return nullptr;
+    }
+    // Created on the first prediction of id, then drawn again for each packet
+    DrawingVisual* GetPrediction(int id)
+    {
+        DrawingVisual* v = FindPrediction(id);
+        if (v == nullptr) {
+            v = new DrawingVisual();
+            v->setData(1001, id);
+            _strokeCV->Children().Add(v);
+        }
+        return v;
+    }
+    void RemovePrediction(int id)
+    {
+        DrawingVisual* v = FindPrediction(id);
+        if (v != nullptr) {
+            _strokeCV->Children().Remove(v);
+            delete v;
+        }
+    }
+    void RemovePredictions()
+    {
+        for (auto const & e : _predictors)
+            RemovePrediction(e.first);
+        _predictors.clear();
+    }
     void AddGroup(int id, Visual * v)
     {
         v->setData(10000, id);
@@ -390,7 +480,12 @@ void DynamicRenderer::Reset(StylusDevice* stylusDevice, SharedPointer<StylusPoin
 
             if (stylusPoints != nullptr)
             {
-                RenderPackets(stylusPoints, si); // do this inside of lock to make sure this renders first.
+                // the caller's points, grouped by contact in a copy if needed
+                SharedPointer<StylusPointCollection> points = stylusPoints;
+                List<StylusContactRange> contacts = Stylus::GetContactRanges(points);
+                // prediction first, RenderPackets prepends the previous point to points
+                RenderPrediction(points, contacts, si->StartTime(), si);
+                RenderPackets(points, contacts, si); // do this inside of lock to make sure this renders first.
             }
         }
     }
@@ -541,7 +636,12 @@ void DynamicRenderer::OnStylusDown(RawStylusInput& rawStylusInput)
         }
 
         rawStylusInput.NotifyWhenProcessed(si);
-        RenderPackets(rawStylusInput.GetStylusPoints(), si);
+        // A new stroke starts from rest, not from where the last one went
+        si->ResetPredictors();
+        List<StylusContactRange> contacts;
+        SharedPointer<StylusPointCollection> stylusPoints = rawStylusInput.GetStylusPoints(contacts);
+        RenderPrediction(stylusPoints, contacts, rawStylusInput.Timestamp(), si);
+        RenderPackets(stylusPoints, contacts, si, rawStylusInput.InputStamp());
     }
 }
 
@@ -565,7 +665,10 @@ void DynamicRenderer::OnStylusMove(RawStylusInput& rawStylusInput)
             if (si->IsTimestampAfter(rawStylusInput.Timestamp()))
             {
                 si->SetLastTime(rawStylusInput.Timestamp());
-                RenderPackets(rawStylusInput.GetStylusPoints(), si);
+                List<StylusContactRange> contacts;
+                SharedPointer<StylusPointCollection> stylusPoints = rawStylusInput.GetStylusPoints(contacts);
+                RenderPrediction(stylusPoints, contacts, rawStylusInput.Timestamp(), si);
+                RenderPackets(stylusPoints, contacts, si, rawStylusInput.InputStamp());
             }
         }
     }
@@ -590,6 +693,8 @@ void DynamicRenderer::OnStylusUp(RawStylusInput& rawStylusInput)
         {
             si->SetSeenUp(true);
             si->SetLastTime(rawStylusInput.Timestamp());
+            // The real ink has caught up, drop what was guessed ahead of it
+            si->RemovePredictions();
             rawStylusInput.NotifyWhenProcessed(si);
         }
     }
@@ -876,42 +981,42 @@ Dispatcher* DynamicRenderer::GetDispatcher()
 
 /////////////////////////////////////////////////////////////////////
 
-void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusPoints,  StrokeInfo* si)
+void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusPoints,
+                                    List<StylusContactRange> const & contacts, StrokeInfo* si,
+                                    int64_t inputStamp)
 {
     // If no points or not hooked up to element then do nothing.
     //qDebug() << "DynamicRenderer::RenderPackets" << stylusPoints->size();
     if (stylusPoints == nullptr || _applicationDispatcher == nullptr)
         return;
 
-    QMap<int, SharedPointer<StylusPointCollection>> collections;
-    if (stylusPoints->Description()->HasProperty(Stylus::StylusPointIdPropertyInfo)) {
-        for (StylusPoint const & sp : *stylusPoints) {
-            int touchId = sp.GetPropertyValue(Stylus::StylusPointIdPropertyInfo);
-            SharedPointer<StylusPointCollection>& c = collections[touchId];
-            if (c == nullptr) {
-                c.reset(new StylusPointCollection(stylusPoints->Description()));
-            }
-            c->Add(sp);
-        }
-    } else if (stylusPoints->Count() > 0) {
-        collections.insert(0, stylusPoints);
-    }
+    LatencyTrace::Scope trace(LatencyTrace::DynamicRender);
 
     List<int> old = si->strokeKeys();
-    auto i = collections.keyValueBegin();
-    for (; i != collections.keyValueEnd(); ++i) {
+    // FitToCurve strokes are fitted and rendered again as a whole with each
+    //  packet, into one visual per contact, the others a segment at a time
+    bool smoothed = si->GetDrawingAttributes()->FitToCurve();
+    for (StylusContactRange const & contact : contacts) {
+        int id = contact.id;
         // Get a collection of ink nodes built from the new stylusPoints.
-        si->SetStrokeNodeIterator((*i).first, si->GetStrokeNodeIterator((*i).first).GetIteratorForNextSegment((*i).second));
-        if (si->GetStrokeNodeIterator((*i).first) != nullptr)
+        if (smoothed)
+            si->SmoothStroke(id, Stylus::GetContactPoints(stylusPoints, contact));
+        else
+            si->SetStrokeNodeIterator(id, si->GetStrokeNodeIterator(id).GetIteratorForNextSegment(
+                                          Stylus::GetContactPoints(stylusPoints, contact)));
+        if (si->GetStrokeNodeIterator(id) != nullptr)
         {
-            old.Remove((*i).first);
+            old.Remove(id);
             // Create a PathGeometry representing the contour of the ink increment
             Geometry* strokeGeometry = nullptr;
             Rect bounds;
     #if DEBUG_RENDERING_FEEDBACK
-            std::unique_ptr<DrawingContext> debugDC;
+            // no feedback is drawn, but the nodes draw into a real context
+            DrawingGroup debugDrawing;
+            std::unique_ptr<DrawingContext> debugDC(debugDrawing.Open());
     #endif
-            StrokeRenderer::CalcGeometryAndBounds(si->GetStrokeNodeIterator((*i).first),
+            int64_t geometryBegin = LatencyTrace::IsEnabled() ? LatencyTrace::Now() : -1;
+            StrokeRenderer::CalcGeometryAndBounds(si->GetStrokeNodeIterator(id),
                                                  *si->GetDrawingAttributes(),
     #if DEBUG_RENDERING_FEEDBACK
                                                  *debugDC, //debug dc
@@ -921,6 +1026,8 @@ void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusP
                                                  false, //calc bounds
                                                  strokeGeometry,
                                                  bounds);
+            if (geometryBegin >= 0)
+                LatencyTrace::Record(LatencyTrace::Geometry, geometryBegin, LatencyTrace::Now());
 
             // If we are called from the app thread we can just stay on it and render to that
             // visual tree.  Otherwise we need to marshal over to our inking thread to do our work.
@@ -945,7 +1052,10 @@ void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusP
                 }
 
                 // Create new visual and render the geometry into it
-                DrawingVisual* visual = new DrawingVisual();
+                DrawingVisual* visual = smoothed ? si->FindVisual(id) : nullptr;
+                bool newVisual = visual == nullptr;
+                if (newVisual)
+                    visual = new DrawingVisual();
                 std::unique_ptr<DrawingContext> drawingContext(visual->RenderOpen());
                 //try
                 {
@@ -954,6 +1064,7 @@ void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusP
                     });
                     OnDraw(*drawingContext, stylusPoints, strokeGeometry, si->FillBrush());
                 }
+                visual->SetInputStamp(inputStamp);
                 //finally
                 //{
                 //    drawingContext.Close();
@@ -961,9 +1072,9 @@ void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusP
 
                 // Now add it to the visual tree (making sure we still have StrokeCV after
                 // onDraw called above).
-                if (si->StrokeCV() != nullptr)
+                if (newVisual && si->StrokeCV() != nullptr)
                 {
-                    si->Add((*i).first, visual);
+                    si->Add(id, visual);
                 }
             }
             else
@@ -1064,6 +1175,75 @@ void DynamicRenderer::RenderPackets(SharedPointer<StylusPointCollection> stylusP
 
 /////////////////////////////////////////////////////////////////////
 
+void DynamicRenderer::RenderPrediction(SharedPointer<StylusPointCollection> stylusPoints,
+                                       List<StylusContactRange> const & contacts, int timestamp, StrokeInfo* si)
+{
+    if (_predictionHorizon <= 0 || stylusPoints == nullptr
+            || _applicationDispatcher == nullptr || !_applicationDispatcher->CheckAccess())
+        return;
+
+    for (StylusContactRange const & contact : contacts) {
+        int id = contact.id;
+        InputPredictor& predictor = si->GetPredictor(id);
+        for (int i = contact.start; i < contact.start + contact.count; ++i)
+            predictor.Add((*stylusPoints)[i], timestamp);
+
+        List<Point> predicted;
+        if (si->StrokeCV() == nullptr)
+            continue;
+        if (!predictor.Predict(_predictionHorizon, PredictionStep, predicted)) {
+            // Keep the visual for the next packet, just empty
+            DrawingVisual* visual = si->FindPrediction(id);
+            if (visual != nullptr) {
+                std::unique_ptr<DrawingContext> drawingContext(visual->RenderOpen());
+                drawingContext->Close();
+            }
+            continue;
+        }
+
+        // The tail starts at the last real point, so it joins the real ink,
+        // and keeps its pressure
+        StylusPoint last = (*stylusPoints)[contact.start + contact.count - 1];
+        SharedPointer<StylusPointCollection> tail(new StylusPointCollection(stylusPoints->Description()));
+        tail->Add(last);
+        for (Point const & pt : predicted) {
+            StylusPoint sp = last;
+            sp.SetX(pt.X());
+            sp.SetY(pt.Y());
+            tail->Add(sp);
+        }
+
+        StrokeNodeIterator iterator = StrokeNodeIterator(*si->GetDrawingAttributes()).GetIteratorForNextSegment(tail);
+        Geometry* strokeGeometry = nullptr;
+        Rect bounds;
+#if DEBUG_RENDERING_FEEDBACK
+        // no feedback is drawn, but the nodes draw into a real context
+        DrawingGroup debugDrawing;
+        std::unique_ptr<DrawingContext> debugDC(debugDrawing.Open());
+#endif
+        StrokeRenderer::CalcGeometryAndBounds(iterator,
+                                             *si->GetDrawingAttributes(),
+#if DEBUG_RENDERING_FEEDBACK
+                                             *debugDC, //debug dc
+                                             0,   //debug feedback size
+                                             false,//render debug feedback
+#endif
+                                             false, //calc bounds
+                                             strokeGeometry,
+                                             bounds);
+
+        std::unique_ptr<DrawingContext> drawingContext(si->GetPrediction(id)->RenderOpen());
+        {
+            FinallyHelper final([&drawingContext]() {
+                drawingContext->Close();
+            });
+            OnDraw(*drawingContext, tail, strokeGeometry, si->FillBrush());
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////
+
 void DynamicRenderer::AbortAllStrokes()
 {
     {
@@ -1228,6 +1408,24 @@ DynamicRenderer::StrokeInfo* DynamicRenderer::FindStrokeInfo(int timestamp)
 
 /////////////////////////////////////////////////////////////////////
 
+/////////////////////////////////////////////////////////////////////
+/// <summary>
+/// How far ahead, in milliseconds, the pen motion is drawn, 0 disables prediction
+/// </summary>
+int DynamicRenderer::PredictionHorizon()
+{
+    return _predictionHorizon;
+}
+
+void DynamicRenderer::SetPredictionHorizon(int value)
+{
+    if (value < 0)
+    {
+        throw std::runtime_error("value");
+    }
+    _predictionHorizon = value;
+}
+
 /////////////////////////////////////////////////////////////////////
 /// <summary>
 /// [TBS] - On UIContext
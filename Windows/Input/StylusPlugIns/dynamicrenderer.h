@@ -15,6 +15,7 @@ INKCANVAS_BEGIN_NAMESPACE
 
 class StylusDevice;
 class StylusPointCollection;
+struct StylusContactRange;
 class DrawingAttributes;
 class Visual;
 class EventArgs;
@@ -186,7 +187,21 @@ protected:
 
     /////////////////////////////////////////////////////////////////////
 
-    void RenderPackets(SharedPointer<StylusPointCollection> stylusPoints,  StrokeInfo* si);
+    /// <summary>
+    /// inputStamp, from RawStylusInput::InputStamp, goes on the visual that
+    /// shows the packets, for LatencyTrace::InputToPaint
+    /// </summary>
+    void RenderPackets(SharedPointer<StylusPointCollection> stylusPoints,
+                       List<StylusContactRange> const & contacts, StrokeInfo* si,
+                       int64_t inputStamp = -1);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Renders a provisional tail where the pen is expected PredictionHorizon
+    /// milliseconds after the given packets, replacing the previous one.
+    /// </summary>
+    void RenderPrediction(SharedPointer<StylusPointCollection> stylusPoints,
+                          List<StylusContactRange> const & contacts, int timestamp, StrokeInfo* si);
 
     /////////////////////////////////////////////////////////////////////
 
@@ -238,6 +253,16 @@ public:
     SharedPointer<DrawingAttributes> GetDrawingAttributes();
     void SetDrawingAttributes(SharedPointer<DrawingAttributes> value);
 
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// How far ahead, in milliseconds, the pen motion is extrapolated and
+    /// drawn ahead of the real packets to hide input latency. The predicted
+    /// tail is only rendered here, it is never part of the collected stroke.
+    /// 0, the default, disables prediction.
+    /// </summary>
+    int PredictionHorizon();
+    void SetPredictionHorizon(int value);
+
     void CreateInkingVisuals();
 
     /// <summary>
@@ -294,6 +319,10 @@ private:
     bool          _waitingForDRThreadRenderComplete;
     QQueue<StrokeInfo*>    _renderCompleteDRThreadStrokeInfoList;
 
+    // Latency hiding
+    int           _predictionHorizon = 0;
+    static constexpr double PredictionStep = 4; // milliseconds between predicted points
+
 };
 
 INKCANVAS_END_NAMESPACE
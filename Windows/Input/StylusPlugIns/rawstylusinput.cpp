@@ -138,6 +138,17 @@ SharedPointer<StylusPointCollection> RawStylusInput::GetStylusPoints(Matrix cons
     }
 }
 
+/// <summary>
+/// Returns a copy of the StylusPoints grouped by contact, contacts holds
+/// the contiguous range of each contact
+/// </summary>
+SharedPointer<StylusPointCollection> RawStylusInput::GetStylusPoints(List<StylusContactRange> & contacts)
+{
+    SharedPointer<StylusPointCollection> stylusPoints = GetStylusPoints();
+    contacts = Stylus::GetContactRanges(stylusPoints);
+    return stylusPoints;
+}
+
 /// <summary>
 /// Replaces the StylusPoints.
 /// </summary>
@@ -238,5 +249,20 @@ void RawStylusInput::SetCurrentNotifyPlugIn(StylusPlugIn* value)
 {
      _currentNotifyPlugIn = value;
 }
+/// <summary>
+/// Drops this input, see StylusPlugInCollection.FireRawStylusInput and PenContexts.
+/// </summary>
+void RawStylusInput::Discard()
+{
+    if (Actions() != RawStylusActions::Move)
+    {
+        throw std::runtime_error("SR.Get(SRID.Stylus_CanOnlyDiscardMove)");
+    }
+    _discarded = true;
+}
+bool RawStylusInput::IsDiscarded()
+{
+     return _discarded;
+}
 
 INKCANVAS_END_NAMESPACE
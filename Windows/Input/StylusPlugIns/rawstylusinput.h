@@ -6,6 +6,8 @@
 #include "sharedptr.h"
 #include "Collections/Generic/list.h"
 
+#include <cstdint>
+
 class QEvent;
 class QTouchEvent;
 class QGraphicsSceneMouseEvent;
@@ -17,6 +19,7 @@ class StylusPlugInCollection;
 class StylusPointCollection;
 class StylusPlugIn;
 class InputDevice;
+struct StylusContactRange;
 
 class RawStylusInputCustomData
 {
@@ -82,6 +85,12 @@ public:
     //[SecurityCritical, SecurityTreatAsSafe]
     SharedPointer<StylusPointCollection> GetStylusPoints(Matrix const & transform);
 
+    /// <summary>
+    /// Returns a copy of the StylusPoints grouped by contact, contacts holds
+    /// the contiguous range of each contact
+    /// </summary>
+    SharedPointer<StylusPointCollection> GetStylusPoints(List<StylusContactRange> & contacts);
+
     /// <summary>
     /// Replaces the StylusPoints.
     /// </summary>
@@ -125,6 +134,22 @@ public:
     /// </summary>
     StylusPlugIn* CurrentNotifyPlugIn();
     void SetCurrentNotifyPlugIn(StylusPlugIn* value);
+
+    /// <summary>
+    /// Drops this input: the remaining StylusPlugIns don't see it and the
+    /// element gets no stylus or mouse event for it. Only valid for
+    /// RawStylusActions::Move, down and up must always reach the element.
+    /// </summary>
+    void Discard();
+    /// <summary>
+    /// True if a StylusPlugIn has discarded this input.
+    /// </summary>
+    bool IsDiscarded();
+    /// <summary>
+    /// Arrival stamp of the packet from LatencyTrace::MarkInput, -1 when not traced.
+    /// </summary>
+    int64_t InputStamp() { return _inputStamp; }
+    void SetInputStamp(int64_t value) { _inputStamp = value; }
     /////////////////////////////////////////////////////////////////////
 
 private:
@@ -139,6 +164,8 @@ private:
     SharedPointer<StylusPointCollection>   _stylusPoints;
     StylusPlugIn*            _currentNotifyPlugIn;
     List<RawStylusInputCustomData>    _customData;
+    bool                     _discarded = false;
+    int64_t                  _inputStamp = -1;
 
 };
 
@@ -264,6 +264,12 @@ void StylusPlugIn::SetEnabled(bool value)
                  InvalidateIsActiveForInput();
              }
          }
+         // Dispatch skips disabled plugins from the next snapshot on,
+         // RawStylusInput2 covers input already in flight
+         if (_pic != nullptr)
+         {
+             _pic->UpdatePlugInSnapshot();
+         }
      }
 }
 
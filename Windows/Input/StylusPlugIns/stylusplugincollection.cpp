@@ -6,9 +6,93 @@
 #include "Windows/dependencypropertychangedeventargs.h"
 #include "Internal/finallyhelper.h"
 #include "Internal/debug.h"
+#include "Internal/latencytrace.h"
+
+#include <QThread>
 
 INKCANVAS_BEGIN_NAMESPACE
 
+/// <summary>
+/// Holds the plug-in snapshot of a collection for one dispatch, without locking.
+/// Registers in the reader slot of the current generation, re-checked so an
+/// update flipping the generation meanwhile waits for this reader or is seen.
+/// </summary>
+class StylusPlugInCollection::SnapshotReader
+{
+public:
+    SnapshotReader(StylusPlugInCollection & collection)
+        : _collection(collection)
+    {
+        for (;;)
+        {
+            _slot = collection._snapshotGeneration.load() & 1;
+            collection._snapshotReaders[_slot].fetch_add(1);
+            if ((collection._snapshotGeneration.load() & 1) == _slot)
+                break;
+            collection._snapshotReaders[_slot].fetch_sub(1);
+        }
+        _snapshot = collection._snapshot.load();
+        _outer = _dispatches;
+        _dispatches = this;
+    }
+
+    ~SnapshotReader()
+    {
+        _dispatches = _outer;
+        _collection._snapshotReaders[_slot].fetch_sub(1);
+        for (PlugInSnapshot const * snapshot : _retired)
+            delete snapshot;
+    }
+
+    PlugInSnapshot const * Snapshot() const
+    {
+        return _snapshot;
+    }
+
+    /// <summary>
+    /// Readers of collection on this thread in slot, an update made from
+    /// inside a dispatch must not wait for itself
+    /// </summary>
+    static int OwnReaders(StylusPlugInCollection const & collection, unsigned slot)
+    {
+        int count = 0;
+        for (SnapshotReader const * reader = _dispatches; reader != nullptr; reader = reader->_outer)
+        {
+            if (&reader->_collection == &collection && reader->_slot == slot)
+                ++count;
+        }
+        return count;
+    }
+
+    /// <summary>
+    /// Hands snapshot to the outermost dispatch of collection on this thread,
+    /// which may still be iterating it, false if there is none
+    /// </summary>
+    static bool Retire(StylusPlugInCollection const & collection, PlugInSnapshot const * snapshot)
+    {
+        SnapshotReader * outermost = nullptr;
+        for (SnapshotReader * reader = _dispatches; reader != nullptr; reader = reader->_outer)
+        {
+            if (&reader->_collection == &collection)
+                outermost = reader;
+        }
+        if (outermost == nullptr)
+            return false;
+        outermost->_retired.push_back(snapshot);
+        return true;
+    }
+
+private:
+    StylusPlugInCollection & _collection;
+    PlugInSnapshot const * _snapshot;
+    unsigned _slot;
+    SnapshotReader * _outer;
+    std::vector<PlugInSnapshot const*> _retired;
+    static thread_local SnapshotReader * _dispatches; // innermost dispatch of this thread
+};
+
+thread_local StylusPlugInCollection::SnapshotReader * StylusPlugInCollection::SnapshotReader::_dispatches = nullptr;
+
 /// <summary>
 /// Insert a StylusPlugIn in the collection at a specific index.
 /// This method should be called from the application context only
@@ -43,6 +127,7 @@ void StylusPlugInCollection::InsertItem(int index, StylusPlugIn* const & plugIn)
                 Debug::Assert(Count() > 0); // If active must have more than one plugin already
                 Collection::InsertItem(index, plugIn);
                 plugIn->Added(this);
+                UpdatePlugInSnapshot();
             }
         }
         else
@@ -55,6 +140,7 @@ void StylusPlugInCollection::InsertItem(int index, StylusPlugIn* const & plugIn)
                     UpdatePenContextsState();
                 });
                 plugIn->Added(this); // Notify plugin that it has been added to collection
+                UpdatePlugInSnapshot();
             }
             //finally
             //{
@@ -122,6 +208,7 @@ void StylusPlugInCollection::RemoveItem(int index)
                 QMutexLocker l(&PenContextsSyncRoot());
                 StylusPlugIn* removedItem = (*this)[index];
                 Collection::RemoveItem(index);
+                UpdatePlugInSnapshot();
                 //try
                 {
                     FinallyHelper final([removedItem](){
@@ -139,6 +226,7 @@ void StylusPlugInCollection::RemoveItem(int index)
         {
             StylusPlugIn* removedItem = (*this)[index];
             Collection::RemoveItem(index);
+            UpdatePlugInSnapshot();
             //try
             {
                 FinallyHelper final([removedItem](){
@@ -184,6 +272,7 @@ void StylusPlugInCollection::SetItem(int index, StylusPlugIn* const & plugIn)
                 QMutexLocker l(&PenContextsSyncRoot());
                 StylusPlugIn* originalPlugIn = (*this)[index];
                 Collection::SetItem(index, plugIn);
+                UpdatePlugInSnapshot();
                 //try
                 {
                     FinallyHelper final([plugIn, this](){
@@ -201,6 +290,7 @@ void StylusPlugInCollection::SetItem(int index, StylusPlugIn* const & plugIn)
         {
             StylusPlugIn* originalPlugIn = (*this)[index];
             Collection::SetItem(index, plugIn);
+            UpdatePlugInSnapshot();
             //try
             {
                 FinallyHelper final([plugIn, this](){
@@ -224,8 +314,12 @@ void StylusPlugInCollection::SetItem(int index, StylusPlugIn* const & plugIn)
 /// </summary>
 /// <param name="element">
 StylusPlugInCollection::StylusPlugInCollection(UIElement* element)
+    : _snapshot(nullptr)
+    , _snapshotGeneration(0)
 {
     _element = element;
+    _snapshotReaders[0].store(0);
+    _snapshotReaders[1].store(0);
 
     //_isEnabledChangedEventHandler = new DependencyPropertyChangedEventHandler(OnIsEnabledChanged);
     //_isVisibleChangedEventHandler = new DependencyPropertyChangedEventHandler(OnIsVisibleChanged);
@@ -234,6 +328,11 @@ StylusPlugInCollection::StylusPlugInCollection(UIElement* element)
     //_layoutChangedEventHandler = new EventHandler(OnLayoutUpdated);
 }
 
+StylusPlugInCollection::~StylusPlugInCollection()
+{
+    delete _snapshot.load();
+}
+
 /// <summary>
 /// Get the UIElement
 /// This method is called from the real-time context.
@@ -343,23 +442,14 @@ QMutex& StylusPlugInCollection::PenContextsSyncRoot()
 /// </summary>
 void StylusPlugInCollection::FireEnterLeave(bool isEnter, RawStylusInput& rawStylusInput, bool confirmed)
 {
-    if (IsActiveForInput())
+    // No lock, the snapshot is held instead, see UpdatePlugInSnapshot
+    SnapshotReader reader(*this);
+    PlugInSnapshot const * snapshot = reader.Snapshot();
+    if (snapshot == nullptr)
+        return;
+    for (StylusPlugIn* plugIn : snapshot->plugIns)
     {
-        // If we are currently active for input then we have a _penContexts that we must lock!
-        {
-            QMutexLocker l(&PenContextsSyncRoot());
-            for (int i = 0; i < Count(); i++)
-            {
-                (*this)[i]->StylusEnterLeave(isEnter, rawStylusInput, confirmed);
-            }
-        }
-    }
-    else
-    {
-        for (int i = 0; i < Count(); i++)
-        {
-            (*this)[i]->StylusEnterLeave(isEnter, rawStylusInput, confirmed);
-        }
+        plugIn->StylusEnterLeave(isEnter, rawStylusInput, confirmed);
     }
 }
 
@@ -370,34 +460,25 @@ void StylusPlugInCollection::FireEnterLeave(bool isEnter, RawStylusInput& rawSty
 /// <param name="args">
 void StylusPlugInCollection::FireRawStylusInput(RawStylusInput& args)
 {
+    LatencyTrace::Scope trace(LatencyTrace::PlugIns);
+    // No lock, the snapshot is held instead, see UpdatePlugInSnapshot
+    SnapshotReader reader(*this);
     //try
     {
         FinallyHelper final([&args](){
             args.SetCurrentNotifyPlugIn(nullptr);
         });
-        if (IsActiveForInput())
+        PlugInSnapshot const * snapshot = reader.Snapshot();
+        if (snapshot == nullptr)
+            return;
+        for (StylusPlugIn* plugIn : snapshot->plugIns)
         {
-            // If we are currently active for input then we have a _penContexts that we must lock!
-            {
-                QMutexLocker l(&PenContextsSyncRoot());
-                for (int i = 0; i < Count(); i++)
-                {
-                    StylusPlugIn* plugIn = (*this)[i];
-                    // set current plugin so any callback data gets an owner.
-                    args.SetCurrentNotifyPlugIn(plugIn);
-                    plugIn->RawStylusInput2(args);
-                }
-            }
-        }
-        else
-        {
-            for (int i = 0; i < Count(); i++)
-            {
-                StylusPlugIn* plugIn = (*this)[i];
-                // set current plugin so any callback data gets an owner.
-                args.SetCurrentNotifyPlugIn(plugIn);
-                plugIn->RawStylusInput2(args);
-            }
+            // set current plugin so any callback data gets an owner.
+            args.SetCurrentNotifyPlugIn(plugIn);
+            plugIn->RawStylusInput2(args);
+            // A plugin dropped the input, later ones must not see it
+            if (args.IsDiscarded())
+                break;
         }
     }
     //finally
@@ -415,6 +496,39 @@ PenContexts* StylusPlugInCollection::GetPenContexts()
     return _penContexts;
 }
 
+/// <summary>
+/// Publishes a new snapshot of the enabled StylusPlugIns, the list that
+/// input is dispatched to without locking.
+/// This method should be called from the application context only.
+/// </summary>
+void StylusPlugInCollection::UpdatePlugInSnapshot()
+{
+    PlugInSnapshot* snapshot = new PlugInSnapshot;
+    snapshot->plugIns.reserve(static_cast<size_t>(Count()));
+    for (int i = 0; i < Count(); i++)
+    {
+        if ((*this)[i]->Enabled())
+            snapshot->plugIns.push_back((*this)[i]);
+    }
+    PlugInSnapshot const * replaced = _snapshot.exchange(snapshot);
+
+    // A dispatch that still holds the replaced snapshot registered before the
+    // exchange, in the slot of the generation current then or the one before.
+    // Flip twice and wait for each slot left behind; dispatches starting
+    // meanwhile count in the other slot, so continuous input cannot hold this
+    // up. Dispatches of this thread, an update made by a plugin, are not
+    // waited for, the outermost of them frees the snapshot when done.
+    for (int phase = 0; phase < 2; ++phase)
+    {
+        unsigned slot = _snapshotGeneration.fetch_add(1) & 1;
+        int own = SnapshotReader::OwnReaders(*this, slot);
+        while (_snapshotReaders[slot].load() > own)
+            QThread::yieldCurrentThread();
+    }
+    if (!SnapshotReader::Retire(*this, replaced))
+        delete replaced;
+}
+
 //#endregion
 
 //#region APIs
@@ -9,6 +9,9 @@
 
 #include <Windows/rect.h>
 
+#include <atomic>
+#include <vector>
+
 INKCANVAS_BEGIN_NAMESPACE
 
 class StylusPlugIn;
@@ -72,6 +75,8 @@ public:
    /// <param name="element">
    StylusPlugInCollection(UIElement* element = nullptr);
 
+   virtual ~StylusPlugInCollection() override;
+
    /// <summary>
    /// Get the UIElement
    /// This method is called from the real-time context.
@@ -145,6 +150,16 @@ public:
    /// </securitynote>
    PenContexts* GetPenContexts();
 
+   /// <summary>
+   /// Publishes a new snapshot of the enabled StylusPlugIns, the list that
+   /// input is dispatched to without locking. Returns once no dispatch on
+   /// another thread can still see the replaced snapshot, so a plugin taken
+   /// out of it is not called anymore.
+   /// This method should be called from the application context only, after
+   /// the collection or the Enabled state of a plugin changed.
+   /// </summary>
+   void UpdatePlugInSnapshot();
+
    //#endregion
 
    //#region APIs
@@ -212,6 +227,19 @@ private:
    /// </securitynote>
    PenContexts* _penContexts = nullptr;
 
+   // Enabled plugins in collection order, replaced as a whole on change.
+   // Dispatch counts itself in the reader slot of the current generation,
+   // an update flips the generation and waits for the slots it left to
+   // drain before freeing the replaced snapshot. See SnapshotReader.
+   struct PlugInSnapshot
+   {
+       std::vector<StylusPlugIn*> plugIns;
+   };
+   class SnapshotReader;
+   std::atomic<PlugInSnapshot const*> _snapshot;
+   std::atomic<unsigned> _snapshotGeneration;
+   std::atomic<int> _snapshotReaders[2];
+
    //DependencyPropertyChangedEventHandler _isEnabledChangedEventHandler;
    //DependencyPropertyChangedEventHandler _isVisibleChangedEventHandler;
    //DependencyPropertyChangedEventHandler _isHitTestVisibleChangedEventHandler;
@@ -0,0 +1,136 @@
+#include "Windows/Input/StylusPlugIns/styluspointdecimator.h"
+#include "Windows/Input/StylusPlugIns/rawstylusinput.h"
+#include "Windows/Input/styluspointcollection.h"
+#include "Windows/vector.h"
+
+#include <cmath>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+StylusPointDecimator::StylusPointDecimator()
+{
+}
+
+void StylusPointDecimator::SetDistanceTolerance(double value)
+{
+    if (value < 0)
+        throw std::runtime_error("value");
+    _distanceTolerance = value;
+}
+
+void StylusPointDecimator::SetAngleTolerance(double value)
+{
+    if (value < 0 || value > 180)
+        throw std::runtime_error("value");
+    _angleTolerance = value;
+}
+
+void StylusPointDecimator::SetCollinearDistance(double value)
+{
+    if (value < 0)
+        throw std::runtime_error("value");
+    _collinearDistance = value;
+}
+
+void StylusPointDecimator::SetPressureTolerance(float value)
+{
+    if (value < 0)
+        throw std::runtime_error("value");
+    _pressureTolerance = value;
+}
+
+void StylusPointDecimator::SetTimeTolerance(int value)
+{
+    if (value < 0)
+        throw std::runtime_error("value");
+    _timeTolerance = value;
+}
+
+void StylusPointDecimator::OnRemoved()
+{
+    _inContact = false;
+    _moveCount = 0;
+    _discardedCount = 0;
+}
+
+void StylusPointDecimator::OnStylusDown(RawStylusInput& rawStylusInput)
+{
+    SharedPointer<StylusPointCollection> stylusPoints = rawStylusInput.GetStylusPoints();
+    _inContact = stylusPoints->Count() > 0;
+    if (!_inContact)
+        return;
+    _stylusDeviceId = rawStylusInput.StylusDeviceId();
+    StylusPoint const & stylusPoint = (*stylusPoints)[stylusPoints->Count() - 1];
+    // The first point has no direction yet
+    _hasDirection = false;
+    _lastKept = stylusPoint;
+    Keep(stylusPoint, rawStylusInput.Timestamp());
+}
+
+void StylusPointDecimator::OnStylusMove(RawStylusInput& rawStylusInput)
+{
+    if (!_inContact || rawStylusInput.StylusDeviceId() != _stylusDeviceId)
+        return;
+
+    SharedPointer<StylusPointCollection> stylusPoints = rawStylusInput.GetStylusPoints();
+    // Several contacts in one packet can't be dropped for one of them only
+    if (stylusPoints->Count() != 1)
+        return;
+
+    ++_moveCount;
+    StylusPoint const & stylusPoint = (*stylusPoints)[0];
+    if (ShouldKeep(stylusPoint, rawStylusInput.Timestamp()))
+    {
+        Keep(stylusPoint, rawStylusInput.Timestamp());
+    }
+    else
+    {
+        ++_discardedCount;
+        rawStylusInput.Discard();
+    }
+}
+
+void StylusPointDecimator::OnStylusUp(RawStylusInput&)
+{
+    _inContact = false;
+}
+
+bool StylusPointDecimator::ShouldKeep(StylusPoint const & stylusPoint, int timestamp)
+{
+    if (_timeTolerance > 0 && timestamp - _lastTimestamp >= _timeTolerance)
+        return true;
+
+    if (std::abs(stylusPoint.PressureFactor() - _lastPressure) >= _pressureTolerance)
+        return true;
+
+    Vector delta = static_cast<Point>(stylusPoint) - _lastKept;
+    double distance = delta.Length();
+    if (distance < _distanceTolerance)
+        return false;
+
+    // Still heading the same way: the dropped point lies within
+    // sin(AngleTolerance) * CollinearDistance of the segment drawn instead
+    if (_angleTolerance > 0 && _hasDirection && distance < _collinearDistance)
+    {
+        double angle = std::abs(Vector::AngleBetween(_lastKept - _previousKept, delta));
+        if (angle < _angleTolerance)
+            return false;
+    }
+
+    return true;
+}
+
+void StylusPointDecimator::Keep(StylusPoint const & stylusPoint, int timestamp)
+{
+    Point point = stylusPoint;
+    if (point != _lastKept)
+    {
+        _previousKept = _lastKept;
+        _hasDirection = true;
+    }
+    _lastKept = point;
+    _lastPressure = stylusPoint.PressureFactor();
+    _lastTimestamp = timestamp;
+}
+
+INKCANVAS_END_NAMESPACE
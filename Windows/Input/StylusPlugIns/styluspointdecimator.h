@@ -0,0 +1,107 @@
+#ifndef STYLUSPOINTDECIMATOR_H
+#define STYLUSPOINTDECIMATOR_H
+
+#include "Windows/Input/StylusPlugIns/stylusplugin.h"
+#include "Windows/point.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+class StylusPoint;
+
+/////////////////////////////////////////////////////////////////////////
+/// <summary>
+/// Drops near duplicate move packets of high report rate pens before they
+/// reach the DynamicRenderer and the element, so fewer points are rendered,
+/// hit-tested and stored. A point is kept if its pressure or its direction
+/// changed noticeably, or if it moved far enough from the last kept point.
+/// Down and up packets always pass.
+/// Insert it at index 0 of the StylusPlugIns, ahead of the DynamicRenderer.
+/// </summary>
+class StylusPointDecimator : public StylusPlugIn
+{
+public:
+    StylusPointDecimator();
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Points closer than this to the last kept point are dropped, in element
+    /// units. Default 1.0
+    /// </summary>
+    double DistanceTolerance() const { return _distanceTolerance; }
+    void SetDistanceTolerance(double value);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Points within CollinearDistance of the last kept point are dropped too
+    /// if they deviate less than this from the direction of the last kept
+    /// segment, in degrees. 0 disables. Default 4
+    /// </summary>
+    double AngleTolerance() const { return _angleTolerance; }
+    void SetAngleTolerance(double value);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Bounds how far collinear points are dropped, and with it how much of
+    /// a corner can be cut, in element units. Default 4.0
+    /// </summary>
+    double CollinearDistance() const { return _collinearDistance; }
+    void SetCollinearDistance(double value);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// A pressure factor change of at least this keeps the point. Default 0.02
+    /// </summary>
+    float PressureTolerance() const { return _pressureTolerance; }
+    void SetPressureTolerance(float value);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Keeps a point at least every so many milliseconds. 0 disables. Default 0
+    /// </summary>
+    int TimeTolerance() const { return _timeTolerance; }
+    void SetTimeTolerance(int value);
+
+    /////////////////////////////////////////////////////////////////////
+    /// <summary>
+    /// Move packets seen and dropped since the plugin was added
+    /// </summary>
+    int MoveCount() const { return _moveCount; }
+    int DiscardedCount() const { return _discardedCount; }
+
+protected:
+    virtual void OnRemoved() override;
+
+    virtual void OnStylusDown(RawStylusInput& rawStylusInput) override;
+
+    virtual void OnStylusMove(RawStylusInput& rawStylusInput) override;
+
+    virtual void OnStylusUp(RawStylusInput& rawStylusInput) override;
+
+private:
+    bool ShouldKeep(StylusPoint const & stylusPoint, int timestamp);
+
+    void Keep(StylusPoint const & stylusPoint, int timestamp);
+
+private:
+    double  _distanceTolerance = 1.0;
+    double  _angleTolerance = 4.0;
+    double  _collinearDistance = 4.0;
+    float   _pressureTolerance = 0.02f;
+    int     _timeTolerance = 0;
+
+    // state of the contact being decimated
+    bool    _inContact = false;
+    int     _stylusDeviceId = 0;
+    bool    _hasDirection = false;
+    Point   _lastKept;
+    Point   _previousKept;
+    float   _lastPressure = 0;
+    int     _lastTimestamp = 0;
+
+    int     _moveCount = 0;
+    int     _discardedCount = 0;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // STYLUSPOINTDECIMATOR_H
@@ -4,9 +4,11 @@
 #include "Windows/Input/StylusPlugIns/stylusplugin.h"
 #include "Windows/Input/StylusPlugIns/stylusplugincollection.h"
 #include "Windows/Input/stylusdevice.h"
+#include "Windows/Input/stylusinputrecorder.h"
 #include "Windows/Input/mousedevice.h"
 #include "Windows/uielement.h"
 #include "Windows/Controls/inkcanvas.h"
+#include "Internal/latencytrace.h"
 
 #include <QTouchEvent>
 #include <QGraphicsSceneMouseEvent>
@@ -45,8 +47,16 @@ void PenContexts::FireCustomData()
     customDatas_.Clear();
 }
 
+void PenContexts::SetRecorder(StylusInputRecorder* recorder)
+{
+    recorder_ = recorder;
+}
+
 bool PenContexts::eventFilter(QObject *watched, QEvent *event)
 {
+    if (recorder_)
+        recorder_->Record(*event);
+    int64_t inputStamp = -1;
     switch (event->type()) {
     case QEvent::TouchBegin:
         if (qobject_cast<InkCanvas*>(element_)->ActiveEditingMode() == InkCanvasEditingMode::Ink) {
@@ -60,10 +70,17 @@ bool PenContexts::eventFilter(QObject *watched, QEvent *event)
     case QEvent::TouchUpdate:
     case QEvent::TouchEnd:
         Stylus::SetLastInput(static_cast<QTouchEvent&>(*event));
+        inputStamp = LatencyTrace::MarkInput();
         customDatas_.Clear();
         for (StylusPlugInCollection* pic : stylusPlugIns_) {
             RawStylusInput stylusInput(static_cast<QTouchEvent&>(*event), transform_, pic);
+            stylusInput.SetInputStamp(inputStamp);
             pic->FireRawStylusInput(stylusInput);
+            // Dropped by a plugin, e.g. StylusPointDecimator, keep it from the element
+            if (stylusInput.IsDiscarded()) {
+                customDatas_.Clear();
+                return true;
+            }
             action_ = stylusInput.Actions();
             customDatas_.AddRange(stylusInput.CustomDataList());
         }
@@ -74,10 +91,16 @@ bool PenContexts::eventFilter(QObject *watched, QEvent *event)
         Mouse::SetLastInput(static_cast<QGraphicsSceneMouseEvent&>(*event));
         if (!element_->acceptTouchEvents() ||
                 static_cast<QGraphicsSceneMouseEvent&>(*event).source() == Qt::MouseEventNotSynthesized) {
+            inputStamp = LatencyTrace::MarkInput();
             customDatas_.Clear();
             for (StylusPlugInCollection* pic : stylusPlugIns_) {
                 RawStylusInput stylusInput(static_cast<QGraphicsSceneMouseEvent&>(*event), transform_, pic);
+                stylusInput.SetInputStamp(inputStamp);
                 pic->FireRawStylusInput(stylusInput);
+                if (stylusInput.IsDiscarded()) {
+                    customDatas_.Clear();
+                    return true;
+                }
                 action_ = stylusInput.Actions();
                 customDatas_.AddRange(stylusInput.CustomDataList());
             }
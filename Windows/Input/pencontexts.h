@@ -13,6 +13,7 @@ INKCANVAS_BEGIN_NAMESPACE
 class StylusPlugInCollection;
 class RawStylusInputCustomData;
 class UIElement;
+class StylusInputRecorder;
 
 class PenContexts : public QObject
 {
@@ -28,6 +29,11 @@ public:
 
     void FireCustomData();
 
+    /// <summary>
+    /// Every input event is handed to recorder before the StylusPlugIns see it
+    /// </summary>
+    void SetRecorder(StylusInputRecorder* recorder);
+
 public:
     bool eventFilter(QObject *watched, QEvent *event) override;
 
@@ -38,6 +44,7 @@ private:
     Matrix transform_;
     RawStylusActions action_;
     List<RawStylusInputCustomData> customDatas_;
+    StylusInputRecorder* recorder_ = nullptr;
 };
 
 INKCANVAS_END_NAMESPACE
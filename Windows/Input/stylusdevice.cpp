@@ -10,6 +10,9 @@
 #include <QTouchEvent>
 #include <QDebug>
 
+#include <algorithm>
+#include <vector>
+
 INKCANVAS_BEGIN_NAMESPACE
 
 StylusEvent::StylusEvent(int type, int type2)
@@ -81,6 +84,73 @@ SharedPointer<StylusPointDescription> Stylus::DefaultPointDescription()
     return description;
 }
 
+List<StylusContactRange> Stylus::GetContactRanges(SharedPointer<StylusPointCollection> & stylusPoints)
+{
+    List<StylusContactRange> ranges;
+    int count = stylusPoints->Count();
+    if (count == 0)
+        return ranges;
+    StylusPointPropertyAccessor idAccessor = stylusPoints->Description()->GetPropertyAccessor(StylusPointIdPropertyInfo);
+    if (!idAccessor.IsValid()) {
+        ranges.Add({0, 0, count});
+        return ranges;
+    }
+    bool interleaved = false;
+    for (int i = 0; i < count; ++i) {
+        int id = idAccessor.Get((*stylusPoints)[i]);
+        if (ranges.Count() > 0 && ranges.back().id == id) {
+            ++ranges.back().count;
+            continue;
+        }
+        for (StylusContactRange const & r : ranges) {
+            if (r.id == id) {
+                interleaved = true;
+                break;
+            }
+        }
+        if (interleaved)
+            break;
+        ranges.Add({id, i, 1});
+    }
+    if (!interleaved)
+        return ranges;
+
+    // rare, e.g. grouped contacts: order by first appearance of each id, in a
+    // copy, the collection may be shared with the caller's listeners
+    List<int> order;
+    for (int i = 0; i < count; ++i) {
+        int id = idAccessor.Get((*stylusPoints)[i]);
+        if (!order.Contains(id))
+            order.Add(id);
+    }
+    std::vector<StylusPoint> points(stylusPoints->begin(), stylusPoints->end());
+    std::stable_sort(points.begin(), points.end(), [&order, &idAccessor](StylusPoint const & l, StylusPoint const & r) {
+        return order.IndexOf(idAccessor.Get(l)) < order.IndexOf(idAccessor.Get(r));
+    });
+    stylusPoints.reset(new StylusPointCollection(stylusPoints->Description(), count));
+    ranges.Clear();
+    for (int i = 0; i < count; ++i) {
+        stylusPoints->Add(points[static_cast<size_t>(i)]);
+        int id = idAccessor.Get(points[static_cast<size_t>(i)]);
+        if (ranges.Count() > 0 && ranges.back().id == id)
+            ++ranges.back().count;
+        else
+            ranges.Add({id, i, 1});
+    }
+    return ranges;
+}
+
+SharedPointer<StylusPointCollection> Stylus::GetContactPoints(SharedPointer<StylusPointCollection> stylusPoints,
+                                                              StylusContactRange const & range)
+{
+    if (range.start == 0 && range.count == stylusPoints->Count())
+        return stylusPoints;
+    SharedPointer<StylusPointCollection> points(new StylusPointCollection(stylusPoints->Description(), range.count));
+    for (int i = range.start; i < range.start + range.count; ++i)
+        points->Add((*stylusPoints)[i]);
+    return points;
+}
+
 QMap<QTouchDevice*, StylusDevice*> Stylus::devices_;
 QSizeF Stylus::groupSize_;
 
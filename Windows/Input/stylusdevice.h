@@ -33,6 +33,16 @@ public:
 
 class StylusPointPropertyInfo;
 
+/// <summary>
+/// The points of one contact in a packet, a contiguous range
+/// </summary>
+struct StylusContactRange
+{
+    int id;
+    int start;
+    int count;
+};
+
 class INKCANVAS_EXPORT Stylus
 {
 public:
@@ -50,6 +60,21 @@ public:
 
     static SharedPointer<StylusPointDescription> DefaultPointDescription();
 
+    /// <summary>
+    /// Groups the points of a packet by contact id, one range per contact in
+    /// order of first appearance. Only if contacts interleave, stylusPoints is
+    /// replaced by a copy with the points grouped (stable), the collection
+    /// passed in is never changed. The id property is resolved once per
+    /// packet; packets without ids are one range of id 0.
+    /// </summary>
+    static List<StylusContactRange> GetContactRanges(SharedPointer<StylusPointCollection> & stylusPoints);
+
+    /// <summary>
+    /// The points of range, stylusPoints itself if the range covers all of them
+    /// </summary>
+    static SharedPointer<StylusPointCollection> GetContactPoints(SharedPointer<StylusPointCollection> stylusPoints,
+                                                                 StylusContactRange const & range);
+
     static StylusEvent StylusDownEvent;
 
     static StylusEvent StylusMoveEvent;
@@ -0,0 +1,258 @@
+#include "Windows/Input/stylusinputrecorder.h"
+#include "Windows/Input/pencontexts.h"
+#include "Windows/uielement.h"
+
+#include <QTouchEvent>
+#include <QGraphicsSceneMouseEvent>
+#include <QGraphicsScene>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QDataStream>
+#include <QIODevice>
+
+#include <algorithm>
+#include <vector>
+#include <stdexcept>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+static constexpr quint32 RecordingMagic = 0x494E4B52; // INKR
+static constexpr quint16 RecordingVersion = 1;
+
+StylusInputRecorder::~StylusInputRecorder()
+{
+    Stop();
+}
+
+void StylusInputRecorder::Start(UIElement *element)
+{
+    Stop();
+    element_ = element;
+    element_->GetPenContexts()->SetRecorder(this);
+}
+
+void StylusInputRecorder::Stop()
+{
+    if (element_) {
+        element_->GetPenContexts()->SetRecorder(nullptr);
+        element_ = nullptr;
+    }
+}
+
+void StylusInputRecorder::Clear()
+{
+    records_.clear();
+}
+
+void StylusInputRecorder::Record(QEvent &event)
+{
+    StylusInputRecord record;
+    record.type = event.type();
+    record.deviceType = 0;
+    record.button = Qt::NoButton;
+    record.buttons = Qt::NoButton;
+    record.source = Qt::MouseEventNotSynthesized;
+    ulong timestamp;
+    switch (event.type()) {
+    case QEvent::TouchBegin:
+    case QEvent::TouchUpdate:
+    case QEvent::TouchEnd:
+    {
+        QTouchEvent& touchEvent(static_cast<QTouchEvent&>(event));
+        timestamp = touchEvent.timestamp();
+        record.modifiers = touchEvent.modifiers();
+        record.deviceType = touchEvent.device()->type();
+        for (QTouchEvent::TouchPoint const & tp : touchEvent.touchPoints()) {
+            record.points.append({tp.id(), tp.state(), tp.pos(), static_cast<float>(tp.pressure())});
+        }
+        break;
+    }
+    case QEvent::GraphicsSceneMousePress:
+    case QEvent::GraphicsSceneMouseMove:
+    case QEvent::GraphicsSceneMouseRelease:
+    {
+        QGraphicsSceneMouseEvent& mouseEvent(static_cast<QGraphicsSceneMouseEvent&>(event));
+        timestamp = mouseEvent.timestamp();
+        record.modifiers = mouseEvent.modifiers();
+        record.button = mouseEvent.button();
+        record.buttons = mouseEvent.buttons();
+        record.source = mouseEvent.source();
+        record.pos = mouseEvent.pos();
+        break;
+    }
+    default:
+        return;
+    }
+    if (records_.isEmpty())
+        firstTimestamp_ = timestamp;
+    record.time = static_cast<quint32>(timestamp - firstTimestamp_);
+    records_.append(record);
+}
+
+void StylusInputRecorder::Save(QIODevice *stream) const
+{
+    QDataStream bw(stream);
+    bw.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    bw << RecordingMagic << RecordingVersion << static_cast<quint32>(records_.size());
+    for (StylusInputRecord const & r : records_) {
+        bw << static_cast<quint16>(r.type) << r.time << static_cast<quint32>(r.modifiers);
+        if (r.type == QEvent::TouchBegin || r.type == QEvent::TouchUpdate || r.type == QEvent::TouchEnd) {
+            bw << static_cast<quint8>(r.deviceType) << static_cast<quint8>(r.points.size());
+            for (StylusInputRecord::TouchPoint const & tp : r.points) {
+                bw << static_cast<qint32>(tp.id) << static_cast<quint8>(tp.state)
+                   << tp.pos.x() << tp.pos.y() << tp.pressure;
+            }
+        } else {
+            bw << static_cast<quint8>(r.button) << static_cast<quint8>(r.buttons)
+               << static_cast<quint8>(r.source) << r.pos.x() << r.pos.y();
+        }
+    }
+}
+
+bool StylusInputRecorder::Load(QIODevice *stream)
+{
+    QDataStream br(stream);
+    br.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    quint32 magic = 0, count = 0;
+    quint16 version = 0;
+    br >> magic >> version >> count;
+    if (magic != RecordingMagic || version != RecordingVersion)
+        return false;
+    // count comes from the file, records are appended as they are read
+    //  rather than reserved up front, so a corrupt count can't allocate
+    QList<StylusInputRecord> records;
+    for (quint32 i = 0; i < count && br.status() == QDataStream::Ok; ++i) {
+        StylusInputRecord r;
+        quint16 type;
+        quint32 modifiers;
+        br >> type >> r.time >> modifiers;
+        r.type = static_cast<QEvent::Type>(type);
+        r.modifiers = static_cast<Qt::KeyboardModifiers>(modifiers);
+        r.deviceType = 0;
+        r.button = Qt::NoButton;
+        r.buttons = Qt::NoButton;
+        r.source = Qt::MouseEventNotSynthesized;
+        if (r.type == QEvent::TouchBegin || r.type == QEvent::TouchUpdate || r.type == QEvent::TouchEnd) {
+            quint8 deviceType, n;
+            br >> deviceType >> n;
+            r.deviceType = deviceType;
+            for (int j = 0; j < n; ++j) {
+                qint32 id;
+                quint8 state;
+                double x, y;
+                float pressure;
+                br >> id >> state >> x >> y >> pressure;
+                r.points.append({id, static_cast<Qt::TouchPointState>(state), QPointF(x, y), pressure});
+            }
+        } else {
+            quint8 button, buttons, source;
+            double x, y;
+            br >> button >> buttons >> source >> x >> y;
+            r.button = static_cast<Qt::MouseButton>(button);
+            r.buttons = static_cast<Qt::MouseButtons>(buttons);
+            r.source = static_cast<Qt::MouseEventSource>(source);
+            r.pos = QPointF(x, y);
+        }
+        records.append(r);
+    }
+    if (br.status() != QDataStream::Ok)
+        return false;
+    records_ = records;
+    return true;
+}
+
+static QTouchDevice* ReplayTouchDevice(int type)
+{
+    for (QTouchDevice const * device : QTouchDevice::devices()) {
+        if (device->type() == type)
+            return const_cast<QTouchDevice*>(device);
+    }
+    static QTouchDevice* devices[2] = {nullptr, nullptr};
+    QTouchDevice*& device = devices[type == QTouchDevice::TouchPad ? 1 : 0];
+    if (device == nullptr) {
+        device = new QTouchDevice;
+        device->setType(static_cast<QTouchDevice::DeviceType>(type));
+        device->setCapabilities(QTouchDevice::Position | QTouchDevice::Pressure);
+    }
+    return device;
+}
+
+static void SendRecord(UIElement* element, StylusInputRecord const & r, ulong timestamp)
+{
+    QGraphicsScene* scene = element->scene();
+    if (r.type == QEvent::TouchBegin || r.type == QEvent::TouchUpdate || r.type == QEvent::TouchEnd) {
+        QList<QTouchEvent::TouchPoint> points;
+        Qt::TouchPointStates states;
+        for (StylusInputRecord::TouchPoint const & p : r.points) {
+            QTouchEvent::TouchPoint tp(p.id);
+            tp.setState(p.state);
+            tp.setPos(p.pos);
+            tp.setScenePos(element->mapToScene(p.pos));
+            tp.setPressure(p.pressure);
+            points.append(tp);
+            states |= p.state;
+        }
+        QTouchEvent event(r.type, ReplayTouchDevice(r.deviceType), r.modifiers, states, points);
+        event.setTimestamp(timestamp);
+        scene->sendEvent(element, &event);
+    } else {
+        QGraphicsSceneMouseEvent event(r.type);
+        event.setPos(r.pos);
+        event.setScenePos(element->mapToScene(r.pos));
+        event.setButton(r.button);
+        event.setButtons(r.buttons);
+        event.setModifiers(r.modifiers);
+        event.setSource(r.source);
+        event.setTimestamp(timestamp);
+        scene->sendEvent(element, &event);
+    }
+}
+
+StylusInputReplayer::Report StylusInputReplayer::Replay(UIElement *element, QList<StylusInputRecord> const & records, bool realTime)
+{
+    if (element == nullptr || element->scene() == nullptr)
+        throw std::runtime_error("element");
+
+    Report report;
+    bool traceEnabled = LatencyTrace::IsEnabled();
+    LatencyTrace::Reset();
+    LatencyTrace::SetEnabled(true);
+
+    std::vector<qint64> durations;
+    durations.reserve(static_cast<size_t>(records.size()));
+    // timestamps continue from now on the clock of Qt's input events, so
+    //  they don't go back in time for plugins
+    ulong base = static_cast<ulong>(QElapsedTimer::msecsSinceReference());
+    QElapsedTimer timer;
+    timer.start();
+    for (StylusInputRecord const & r : records) {
+        if (realTime) {
+            qint64 wait;
+            while ((wait = r.time - timer.elapsed()) > 0)
+                QCoreApplication::processEvents(QEventLoop::AllEvents, static_cast<int>(wait));
+        }
+        qint64 begin = timer.nsecsElapsed();
+        SendRecord(element, r, base + r.time);
+        durations.push_back((timer.nsecsElapsed() - begin) / 1000);
+    }
+    QCoreApplication::processEvents();
+    report.replayTime = timer.nsecsElapsed() / 1000;
+
+    report.events = records.size();
+    report.recordedTime = records.isEmpty() ? 0 : records.last().time;
+    if (!durations.empty()) {
+        qint64 total = 0;
+        for (qint64 d : durations)
+            total += d;
+        report.eventMean = static_cast<double>(total) / durations.size();
+        std::sort(durations.begin(), durations.end());
+        report.eventP95 = durations[(durations.size() - 1) * 95 / 100];
+        report.eventMax = durations.back();
+    }
+    for (int i = 0; i < LatencyTrace::StageCount; ++i)
+        report.stages[i] = LatencyTrace::GetSummary(static_cast<LatencyTrace::Stage>(i));
+    LatencyTrace::SetEnabled(traceEnabled);
+    return report;
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,124 @@
+#ifndef WINDOWS_INPUT_STYLUSINPUTRECORDER_H
+#define WINDOWS_INPUT_STYLUSINPUTRECORDER_H
+
+#include "Internal/latencytrace.h"
+
+#include <QEvent>
+#include <QPointF>
+#include <QList>
+
+class QIODevice;
+
+INKCANVAS_BEGIN_NAMESPACE
+
+class UIElement;
+
+/// <summary>
+/// One touch or mouse event as it reached the PenContexts of an element,
+/// positions in element coordinates
+/// </summary>
+struct StylusInputRecord
+{
+    struct TouchPoint
+    {
+        int id;
+        Qt::TouchPointState state;
+        QPointF pos;
+        float pressure;
+    };
+
+    QEvent::Type type;
+    // milliseconds since the first record
+    quint32 time;
+    Qt::KeyboardModifiers modifiers;
+    // touch
+    int deviceType;
+    QList<TouchPoint> points;
+    // mouse
+    Qt::MouseButton button;
+    Qt::MouseButtons buttons;
+    Qt::MouseEventSource source;
+    QPointF pos;
+};
+
+/// <summary>
+/// Records the raw input of an element, ahead of its StylusPlugIns, so that
+/// inking, erasing and selection sessions can be replayed with their original
+/// pen timing by StylusInputReplayer.
+///
+/// Serialized layout (QDataStream, single precision):
+///   quint32 magic 'INKR', quint16 version, quint32 count, records
+/// </summary>
+class INKCANVAS_EXPORT StylusInputRecorder
+{
+public:
+    ~StylusInputRecorder();
+
+    /// <summary>
+    /// Starts recording input that reaches element, records are appended
+    /// </summary>
+    void Start(UIElement* element);
+
+    void Stop();
+
+    bool IsRecording() const { return element_ != nullptr; }
+
+    void Clear();
+
+    QList<StylusInputRecord> const & Records() const { return records_; }
+
+    void Save(QIODevice * stream) const;
+
+    /// <summary>
+    /// Replaces the records with those in stream, returns false if stream
+    /// is not a recording
+    /// </summary>
+    bool Load(QIODevice * stream);
+
+    /// <summary>
+    /// Called by PenContexts for every event of the element
+    /// </summary>
+    void Record(QEvent & event);
+
+private:
+    UIElement* element_ = nullptr;
+    QList<StylusInputRecord> records_;
+    ulong firstTimestamp_ = 0;
+};
+
+/// <summary>
+/// Feeds recorded input back into an element through the same path as real
+/// input: PenContexts, StylusPlugIns and the element's stylus/mouse handlers
+/// (EditingCoordinator for InkCanvas). Event timestamps are restored, so
+/// time dependent plugins behave as in the recorded session.
+/// </summary>
+class INKCANVAS_EXPORT StylusInputReplayer
+{
+public:
+    struct Report
+    {
+        int events = 0;
+        // length of the recorded session, milliseconds
+        qint64 recordedTime = 0;
+        // wall time of the replay, microseconds
+        qint64 replayTime = 0;
+        // dispatch time of single events, microseconds
+        double eventMean = 0;
+        double eventP95 = 0;
+        double eventMax = 0;
+        // pipeline stages, see LatencyTrace
+        LatencyTrace::Summary stages[LatencyTrace::StageCount];
+    };
+
+    /// <summary>
+    /// Replays records into element, which must be in a scene. With realTime,
+    /// events are spaced as recorded and the event loop runs in between,
+    /// otherwise they are sent back to back and pending paints run once at
+    /// the end. LatencyTrace is reset and enabled for the replay.
+    /// </summary>
+    static Report Replay(UIElement* element, QList<StylusInputRecord> const & records, bool realTime);
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_INPUT_STYLUSINPUTRECORDER_H
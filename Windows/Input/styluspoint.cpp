@@ -146,6 +146,26 @@ void StylusPoint::SetY(double value)
     _y = GetClampedXYValue(value);
 }
 
+void StylusPoint::ClampXY(double * x, double * y, int count)
+{
+    bool nanX = false, nanY = false;
+    for (int i = 0; i < count; i++)
+    {
+        nanX |= x[i] != x[i];
+        nanY |= y[i] != y[i];
+        x[i] = x[i] > MaxXY ? MaxXY : (x[i] < MinXY ? MinXY : x[i]);
+        y[i] = y[i] > MaxXY ? MaxXY : (y[i] < MinXY ? MinXY : y[i]);
+    }
+    if (nanX)
+    {
+        throw std::runtime_error("X");
+    }
+    if (nanY)
+    {
+        throw std::runtime_error("Y");
+    }
+}
+
 /// <summary>
 /// PressureFactor.  A value between 0.0 (no pressure) and 1.0 (max pressure)
 /// </summary>
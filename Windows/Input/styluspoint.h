@@ -15,6 +15,9 @@ class StylusPointDescription;
 
 class INKCANVAS_EXPORT StylusPoint
 {
+    friend class StylusPointPropertyAccessor;
+    friend class StylusPointCollection;
+
 public:
     static constexpr float DefaultPressure = 0.5f;
 
@@ -104,6 +107,12 @@ public:
 
     void SetY(double value);
 
+    /// <summary>
+    /// Checks and clamps count X and Y values in place, as SetX and SetY do
+    /// to each value, in one pass over the arrays
+    /// </summary>
+    static void ClampXY(double * x, double * y, int count);
+
     /// <summary>
     /// PressureFactor.  A value between 0.0 (no pressure) and 1.0 (max pressure)
     /// </summary>
@@ -6,6 +6,8 @@
 #include "Windows/Ink/events.h"
 #include "Internal/debug.h"
 
+#include <algorithm>
+
 #ifndef INKCANVAS_CORE
 #include "Internal/Ink/InkSerializedFormat/strokecollectionserializer.h"
 #else
@@ -20,6 +22,9 @@ public:
 
 INKCANVAS_BEGIN_NAMESPACE
 
+// Points transformed at once by Matrix::Transform(double *, double *, int)
+static constexpr int TransformRunLength = 64;
+
 StylusPointCollection::StylusPointCollection()
     : _stylusPointDescription(new StylusPointDescription())
 {
@@ -141,20 +146,31 @@ StylusPointCollection::StylusPointCollection(SharedPointer<StylusPointDescriptio
     // set our capacity and validate
     //
     SetCapacity(logicalPointCount);
+    (void) tabletToView;
+    double xs[TransformRunLength];
+    double ys[TransformRunLength];
     for (int count = 0, i = 0; count < logicalPointCount; count++, i += lengthPerPoint)
     {
-
-        //first, determine the x, y values by xf-ing them
-        Point p(rawPacketData[i], rawPacketData[i + 1]);
-        (void) tabletToView;
-        //if (tabletToView != nullptr)
-        //{
-        //    p = tabletToView.map(p);
-        //}
-        //else
+        //first, determine the x, y values by xf-ing them, a run of points at once
+        int run = count % TransformRunLength;
+        if (run == 0)
         {
-            p = tabletToViewMatrix.Transform(p);
+            int n = std::min(logicalPointCount - count, TransformRunLength);
+            for (int r = 0, j = i; r < n; r++, j += lengthPerPoint)
+            {
+                xs[r] = rawPacketData[j];
+                ys[r] = rawPacketData[j + 1];
+            }
+            //if (tabletToView != nullptr)
+            //{
+            //    tabletToView.map(p);
+            //}
+            //else
+            {
+                tabletToViewMatrix.Transform(xs, ys, n);
+            }
         }
+        Point p(xs[run], ys[run]);
 
         int startIndex = 2;
         bool containsTruePressure = stylusPointDescription->ContainsTruePressure();
@@ -363,22 +379,13 @@ SharedPointer<StylusPointCollection> StylusPointCollection::Clone(Matrix const &
     //
     SharedPointer<StylusPointCollection> newCollection(new StylusPointCollection(descriptionToUse, count));
 
-    bool isIdentity = transform.IsIdentity();
     for (int x = 0; x < count; x++)
     {
-        if (isIdentity)
-        {
-            newCollection->Items().Add((*this)[x]);
-        }
-        else
-        {
-            Point point;
-            StylusPoint stylusPoint = (*this)[x];
-            point = stylusPoint;
-            point = transform.Transform(point);
-            stylusPoint = point;
-            newCollection->Items().Add(stylusPoint);
-        }
+        newCollection->Items().Add((*this)[x]);
+    }
+    if (!transform.IsIdentity())
+    {
+        newCollection->TransformPoints(transform);
     }
     return newCollection;
 }
@@ -389,8 +396,12 @@ SharedPointer<StylusPointCollection> StylusPointCollection::Clone(Matrix const &
 /// <param name="e">
 void StylusPointCollection::OnChanged()
 {
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     emit Changed();
+#else
+    _observers.Notify([this](StylusPointCollectionObserver & observer) {
+        observer.StylusPoints_Changed(*this);
+    });
 #endif
 }
 
@@ -400,18 +411,7 @@ void StylusPointCollection::OnChanged()
 /// <param name="transform">transform
 void StylusPointCollection::Transform(Matrix const & transform)
 {
-    Point point;
-    for (int i = 0; i < Count(); i++)
-    {
-        StylusPoint & stylusPoint = Items()[i];
-        point = stylusPoint;
-        point = transform.Transform(point);
-        stylusPoint.SetX(point.X());
-        stylusPoint.SetY(point.Y());
-
-        //this does not go through our virtuals
-        //at(i) = stylusPoint;
-    }
+    TransformPoints(transform);
 
     if (Count() > 0)
     {
@@ -419,6 +419,35 @@ void StylusPointCollection::Transform(Matrix const & transform)
     }
 }
 
+/// <summary>
+/// Transforms X and Y of all points a run at a time, without raising Changed
+/// </summary>
+void StylusPointCollection::TransformPoints(Matrix const & transform)
+{
+    double x[TransformRunLength];
+    double y[TransformRunLength];
+    int count = Count();
+    for (int start = 0; start < count; start += TransformRunLength)
+    {
+        int n = std::min(count - start, TransformRunLength);
+        for (int i = 0; i < n; i++)
+        {
+            StylusPoint const & stylusPoint = (*this)[start + i];
+            x[i] = stylusPoint.X();
+            y[i] = stylusPoint.Y();
+        }
+        transform.Transform(x, y, n);
+        StylusPoint::ClampXY(x, y, n);
+        for (int i = 0; i < n; i++)
+        {
+            //this does not go through our virtuals
+            StylusPoint & stylusPoint = Items()[start + i];
+            stylusPoint._x = x[i];
+            stylusPoint._y = y[i];
+        }
+    }
+}
+
 /// <summary>
 /// Reformat
 /// </summary>
@@ -459,21 +488,45 @@ SharedPointer<StylusPointCollection> StylusPointCollection::Reformat(SharedPoint
             = subsetToReformatToWithCurrentMetrics->GetStylusPointProperties();
     bool isIdentity = transform.IsIdentity();
 
+    // resolve the properties to copy once, not per point
+    List<StylusPointPropertyAccessor> sourceAccessors;
+    List<StylusPointPropertyAccessor> targetAccessors;
+    //start at 3, skipping x, y, pressure
+    for (int x = StylusPointDescription::RequiredCountOfProperties/*3*/; x < properties.Count(); x++)
+    {
+        StylusPointPropertyAccessor source = Description()->GetPropertyAccessor(properties[x]);
+        if (!source.IsValid())
+        {
+            throw std::runtime_error("stylusPointProperty");
+        }
+        sourceAccessors.Add(source);
+        targetAccessors.Add(subsetToReformatToWithCurrentMetrics->GetPropertyAccessor(properties[x]));
+    }
+
+    double xs[TransformRunLength];
+    double ys[TransformRunLength];
     for (int i = 0; i < Count(); i++)
     {
         StylusPoint stylusPoint = (*this)[i];
 
-        double xCoord = stylusPoint.X();
-        double yCoord = stylusPoint.Y();
-        float pressure = stylusPoint.GetUntruncatedPressureFactor();
-
-        if (!isIdentity)
+        int run = i % TransformRunLength;
+        if (run == 0)
         {
-            Point p(xCoord, yCoord);
-            p = transform.Transform(p);
-            xCoord = p.X();
-            yCoord = p.Y();
+            int n = std::min(Count() - i, TransformRunLength);
+            for (int r = 0; r < n; r++)
+            {
+                StylusPoint const & p = (*this)[i + r];
+                xs[r] = p.X();
+                ys[r] = p.Y();
+            }
+            if (!isIdentity)
+            {
+                transform.Transform(xs, ys, n);
+            }
         }
+        double xCoord = xs[run];
+        double yCoord = ys[run];
+        float pressure = stylusPoint.GetUntruncatedPressureFactor();
 
         Array<int> newData;
         if (additionalDataCount > 0)
@@ -484,11 +537,9 @@ SharedPointer<StylusPointCollection> StylusPointCollection::Reformat(SharedPoint
 
         StylusPoint newStylusPoint(xCoord, yCoord, pressure, subsetToReformatToWithCurrentMetrics, newData, false, false);
 
-        //start at 3, skipping x, y, pressure
-        for (int x = StylusPointDescription::RequiredCountOfProperties/*3*/; x < properties.Count(); x++)
+        for (int x = 0; x < sourceAccessors.Count(); x++)
         {
-            int value = stylusPoint.GetPropertyValue(properties[x]);
-            newStylusPoint.SetPropertyValue(properties[x], value, false/*copy on write*/);
+            targetAccessors[x].Set(newStylusPoint, sourceAccessors[x].Get(stylusPoint));
         }
         //bypass validation
         newCollection->Items().Add(newStylusPoint);
@@ -506,13 +557,14 @@ Array<int> StylusPointCollection::ToHiMetricArray()
     // X and Y are in Avalon units, we need to convert to HIMETRIC
     //
     int lengthPerPoint = Description()->GetOutputArrayLengthPerPoint();
+    StylusPointPropertyAccessor pressure = Description()->GetPropertyAccessor(StylusPointProperties::NormalPressure);
     Array<int> output(lengthPerPoint * Count());
     for (int i = 0, x = 0; i < Count(); i++, x += lengthPerPoint)
     {
-        StylusPoint stylusPoint = (*this)[i];
+        StylusPoint const & stylusPoint = (*this)[i];
         output[x] = Math::Round(stylusPoint.X() * StrokeCollectionSerializer::AvalonToHimetricMultiplier);
         output[x + 1] = Math::Round(stylusPoint.Y() * StrokeCollectionSerializer::AvalonToHimetricMultiplier);
-        output[x + 2] = stylusPoint.GetPropertyValue(StylusPointProperties::NormalPressure);
+        output[x + 2] = pressure.Get(stylusPoint);
 
         if (lengthPerPoint > StylusPointDescription::RequiredCountOfProperties/*3*/)
         {
@@ -576,12 +628,13 @@ void StylusPointCollection::ToISFReadyArrays(Array<Array<int>> & output, bool &
     shouldPersistPressure =
         !StylusPointPropertyInfo::AreCompatible(pressureInfo, StylusPointPropertyInfoDefaults::NormalPressure);
 
+    StylusPointPropertyAccessor pressure = Description()->GetPropertyAccessor(StylusPointProperties::NormalPressure);
     for (int b = 0; b < Count(); b++)
     {
-        StylusPoint stylusPoint = (*this)[b];
+        StylusPoint const & stylusPoint = (*this)[b];
         output[0][b] = Math::Round(stylusPoint.X() * StrokeCollectionSerializer::AvalonToHimetricMultiplier);
         output[1][b] = Math::Round(stylusPoint.Y() * StrokeCollectionSerializer::AvalonToHimetricMultiplier);
-        output[2][b] = stylusPoint.GetPropertyValue(StylusPointProperties::NormalPressure);
+        output[2][b] = pressure.Get(stylusPoint);
         //
         // it's not necessary to check HasDefaultPressure if
         // allDefaultPressures is already set
@@ -623,12 +676,16 @@ bool StylusPointCollection::CanGoToZero()
     CancelEventArgs e;
     //e.Cancel = false;
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
     //
     // call the listeners
     //
     emit CountGoingToZero(e);
     Debug::Assert(e.Cancel(), "This event should always be cancelled");
+#else
+    _observers.Notify([this, &e](StylusPointCollectionObserver & observer) {
+        observer.StylusPoints_CountGoingToZero(*this, e);
+    });
 #endif
     return !e.Cancel();
 
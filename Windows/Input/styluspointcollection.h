@@ -8,8 +8,10 @@
 #include "Windows/Media/matrix.h"
 #include "sharedptr.h"
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 #include <QObject>
+#else
+#include "Internal/Ink/changeobservers.h"
 #endif
 
 
@@ -20,7 +22,7 @@ class CancelEventArgs;
 
 // namespace System.Windows.Input
 
-#ifdef INKCANVAS_QT_SIGNALS
+#ifdef INKCANVAS_INK_SIGNALS
 class INKCANVAS_EXPORT StylusPointCollection : public QObject, public Collection<StylusPoint>
 {
     Q_OBJECT
@@ -42,7 +44,18 @@ class INKCANVAS_EXPORT StylusPointCollection : public Collection<StylusPoint>
 public:
     virtual ~StylusPointCollection() {}
 
+    /// <summary>
+    /// Adds an observer of the collection, in place of connecting to the
+    /// Changed and CountGoingToZero signals
+    /// </summary>
+    void AddObserver(StylusPointCollectionObserver * observer) { _observers.Add(observer); }
+
+    void RemoveObserver(StylusPointCollectionObserver * observer) { _observers.Remove(observer); }
+
 #endif
+    // bulk writes of a resolved property
+    friend class StylusPointPropertyAccessor;
+
     StylusPointCollection();
 
     /// <summary>
@@ -205,7 +218,15 @@ public:
     bool CanGoToZero();
 
 private:
+    /// <summary>
+    /// Transforms X and Y of all points a run at a time, without raising Changed
+    /// </summary>
+    void TransformPoints(Matrix const & transform);
+
     SharedPointer<StylusPointDescription> _stylusPointDescription;
+#ifndef INKCANVAS_INK_SIGNALS
+    ObserverList<StylusPointCollectionObserver> _observers;
+#endif
 };
 
 INKCANVAS_END_NAMESPACE
@@ -124,6 +124,48 @@ int StylusPointDescription::GetPropertyIndex(Guid Guid) const
     return IndexOf(Guid);
 }
 
+/// <summary>
+/// Resolves stylusPointProperty once for repeated access to points of this
+/// description. The accessor is invalid if the property is not present.
+/// </summary>
+StylusPointPropertyAccessor StylusPointDescription::GetPropertyAccessor(StylusPointProperty const & stylusPointProperty) const
+{
+    StylusPointPropertyAccessor accessor;
+    int index = IndexOf(stylusPointProperty.Id());
+    if (-1 == index)
+    {
+        return accessor;
+    }
+    accessor._propertyIndex = index;
+    switch (index)
+    {
+    case RequiredXIndex:
+        accessor._kind = StylusPointPropertyAccessor::X;
+        break;
+    case RequiredYIndex:
+        accessor._kind = StylusPointPropertyAccessor::Y;
+        break;
+    case RequiredPressureIndex:
+        accessor._kind = StylusPointPropertyAccessor::NormalPressure;
+        accessor._pressureMinimum = _stylusPointPropertyInfos[index].Minimum();
+        accessor._pressureMaximum = _stylusPointPropertyInfos[index].Maximum();
+        break;
+    default:
+        if (_stylusPointPropertyInfos[index].IsButton())
+        {
+            accessor._kind = StylusPointPropertyAccessor::Button;
+            accessor._slot = GetButtonBitPosition(stylusPointProperty);
+        }
+        else
+        {
+            accessor._kind = StylusPointPropertyAccessor::Value;
+            accessor._slot = index - RequiredCountOfProperties;
+        }
+        break;
+    }
+    return accessor;
+}
+
 /// <summary>
 /// GetStylusPointProperties
 /// </summary>
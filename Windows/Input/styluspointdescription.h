@@ -2,6 +2,7 @@
 #define WINDOWS_INPUT_STYLUSPOINTDESCRIPTION_H
 
 #include "Windows/Input/styluspointpropertyinfo.h"
+#include "Windows/Input/styluspointpropertyaccessor.h"
 
 #include "Collections/Generic/list.h"
 #include "Collections/Generic/array.h"
@@ -72,6 +73,12 @@ public:
     /// </summary>
     int GetPropertyIndex(Guid Guid) const;
 
+    /// <summary>
+    /// Resolves stylusPointProperty once for repeated access to points of this
+    /// description. The accessor is invalid if the property is not present.
+    /// </summary>
+    StylusPointPropertyAccessor GetPropertyAccessor(StylusPointProperty const & stylusPointProperty) const;
+
     /// <summary>
     /// GetStylusPointProperties
     /// </summary>
@@ -0,0 +1,87 @@
+#include "Windows/Input/styluspointpropertyaccessor.h"
+#include "Windows/Input/styluspointcollection.h"
+#include "Windows/Input/styluspoint.h"
+
+#include <stdexcept>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+int StylusPointPropertyAccessor::Get(StylusPoint const & stylusPoint) const
+{
+    switch (_kind)
+    {
+    case X:
+        return static_cast<int>(stylusPoint._x);
+    case Y:
+        return static_cast<int>(stylusPoint._y);
+    case NormalPressure:
+        return static_cast<int>(stylusPoint._pressureFactor * _pressureMaximum);
+    case Value:
+        return stylusPoint._additionalValues[_slot];
+    case Button:
+        return (stylusPoint._additionalValues[stylusPoint._additionalValues.Length() - 1] >> _slot) & 1;
+    default:
+        throw std::runtime_error("stylusPointProperty");
+    }
+}
+
+void StylusPointPropertyAccessor::Set(StylusPoint & stylusPoint, int value) const
+{
+    switch (_kind)
+    {
+    case X:
+        stylusPoint._x = StylusPoint::GetClampedXYValue(value);
+        break;
+    case Y:
+        stylusPoint._y = StylusPoint::GetClampedXYValue(value);
+        break;
+    case NormalPressure:
+        stylusPoint._pressureFactor = _pressureMaximum == 0
+                ? 0.0f : static_cast<float>(_pressureMinimum + value) / _pressureMaximum;
+        break;
+    case Value:
+        stylusPoint._additionalValues[_slot] = value;
+        break;
+    case Button:
+    {
+        if (value < 0 || value > 1)
+        {
+            throw std::runtime_error("value");
+        }
+        int & buttonData = stylusPoint._additionalValues[stylusPoint._additionalValues.Length() - 1];
+        if (value == 0)
+            buttonData &= ~(1 << _slot);
+        else
+            buttonData |= (1 << _slot);
+        break;
+    }
+    default:
+        throw std::runtime_error("propertyId");
+    }
+}
+
+void StylusPointPropertyAccessor::GetValues(StylusPointCollection const & stylusPoints, int * values) const
+{
+    int count = stylusPoints.Count();
+    if (_kind == Value)
+    {
+        // the common case, no switch per point
+        for (int i = 0; i < count; ++i)
+            values[i] = stylusPoints[i]._additionalValues[_slot];
+        return;
+    }
+    for (int i = 0; i < count; ++i)
+        values[i] = Get(stylusPoints[i]);
+}
+
+void StylusPointPropertyAccessor::SetValues(StylusPointCollection & stylusPoints, int const * values) const
+{
+    List<StylusPoint> & items = stylusPoints.Items();
+    int count = items.Count();
+    for (int i = 0; i < count; ++i)
+        Set(items[i], values[i]);
+    if (count > 0)
+        stylusPoints.OnChanged();
+}
+
+INKCANVAS_END_NAMESPACE
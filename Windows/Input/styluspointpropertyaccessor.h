@@ -0,0 +1,77 @@
+#ifndef WINDOWS_INPUT_STYLUSPOINTPROPERTYACCESSOR_H
+#define WINDOWS_INPUT_STYLUSPOINTPROPERTYACCESSOR_H
+
+#include "InkCanvas_global.h"
+
+// namespace System.Windows.Input
+INKCANVAS_BEGIN_NAMESPACE
+
+class StylusPoint;
+class StylusPointCollection;
+
+/// <summary>
+/// A StylusPointProperty resolved against a StylusPointDescription, see
+/// StylusPointDescription::GetPropertyAccessor. The Guid compares and the
+/// index search are done once, reading or writing the property of a point
+/// is then an indexed load or store. Valid for points of that description
+/// or of a compatible one (same properties in the same order).
+/// </summary>
+class INKCANVAS_EXPORT StylusPointPropertyAccessor
+{
+public:
+    /// <summary>
+    /// Invalid accessor, of a property the description doesn't have
+    /// </summary>
+    StylusPointPropertyAccessor() = default;
+
+    bool IsValid() const { return _kind != None; }
+
+    /// <summary>
+    /// Index of the property in the description, -1 if invalid
+    /// </summary>
+    int PropertyIndex() const { return _propertyIndex; }
+
+    /// <summary>
+    /// Same as StylusPoint::GetPropertyValue
+    /// </summary>
+    int Get(StylusPoint const & stylusPoint) const;
+
+    /// <summary>
+    /// Same as StylusPoint::SetPropertyValue
+    /// </summary>
+    void Set(StylusPoint & stylusPoint, int value) const;
+
+    /// <summary>
+    /// Reads the property of all points, values must hold Count() ints
+    /// </summary>
+    void GetValues(StylusPointCollection const & stylusPoints, int * values) const;
+
+    /// <summary>
+    /// Writes the property of all points, raises Changed once
+    /// </summary>
+    void SetValues(StylusPointCollection & stylusPoints, int const * values) const;
+
+private:
+    friend class StylusPointDescription;
+
+    enum Kind : unsigned char
+    {
+        None,
+        X,
+        Y,
+        NormalPressure,
+        Value,
+        Button
+    };
+
+    Kind _kind = None;
+    int _propertyIndex = -1;
+    // Value: slot in the additional data, Button: bit in the last slot
+    int _slot = 0;
+    int _pressureMinimum = 0;
+    int _pressureMaximum = 0;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_INPUT_STYLUSPOINTPROPERTYACCESSOR_H
@@ -1,14 +1,24 @@
 HEADERS += \
     $$PWD/geometry.h \
     $$PWD/matrix.h \
+    $$PWD/pathbuffer.h \
+    $$PWD/pathbufferstreamgeometrycontext.h \
+    $$PWD/scanlinerasterizer.h \
+    $$PWD/simplifyingstreamgeometrycontext.h \
     $$PWD/streamgeometry.h \
     $$PWD/streamgeometrycontext.h \
+    $$PWD/transformingstreamgeometrycontext.h \
 
 SOURCES += \
     $$PWD/geometry.cpp \
     $$PWD/matrix.cpp \
+    $$PWD/pathbuffer.cpp \
+    $$PWD/pathbufferstreamgeometrycontext.cpp \
+    $$PWD/scanlinerasterizer.cpp \
+    $$PWD/simplifyingstreamgeometrycontext.cpp \
     $$PWD/streamgeometry.cpp \
     $$PWD/streamgeometrycontext.cpp \
+    $$PWD/transformingstreamgeometrycontext.cpp \
 
 !inkcanvas_core:  {
 
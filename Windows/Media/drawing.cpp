@@ -79,9 +79,7 @@ GeometryDrawing::GeometryDrawing()
 
 GeometryDrawing::~GeometryDrawing()
 {
-    if (geometry_ && geometry_->tryTakeOwn(this))
-        delete geometry_;
-    geometry_ = nullptr;
+    SetGeometry(nullptr);
 }
 
 void GeometryDrawing::SetBrush(QBrush brush)
@@ -96,6 +94,11 @@ void GeometryDrawing::SetPen(QPen pen)
 
 void GeometryDrawing::SetGeometry(Geometry * g)
 {
+    if (g)
+        g->addUser();
+    // The owner may have dropped the geometry while we show it
+    if (geometry_ && geometry_->removeUser() == 0 && geometry_->tryTakeOwn(this))
+        delete geometry_;
     geometry_ = g;
 }
 
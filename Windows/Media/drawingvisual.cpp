@@ -1,5 +1,6 @@
 #include "Windows/Media/drawingvisual.h"
 #include "Windows/Media/drawing.h"
+#include "Internal/latencytrace.h"
 
 #include <QPainter>
 #include <QDebug>
@@ -45,9 +46,21 @@ DrawingContext * DrawingVisual::RenderOpen()
     return new VisualDrawingContext(this);
 }
 
+DrawingContext * DrawingVisual::RenderOpenInPlace()
+{
+    if (drawing_)
+        delete drawing_;
+    drawing_ = new DrawingGroup;
+    inPlace_ = true;
+    return new VisualDrawingContext(this);
+}
+
 void DrawingVisual::RenderClose()
 {
-    prepareGeometryChange();
+    if (inPlace_)
+        inPlace_ = false;
+    else
+        prepareGeometryChange();
 }
 
 DrawingGroup * DrawingVisual::GetDrawing()
@@ -55,6 +68,17 @@ DrawingGroup * DrawingVisual::GetDrawing()
     return drawing_;
 }
 
+void DrawingVisual::SetInputStamp(int64_t stamp)
+{
+    inputStamp_ = stamp;
+}
+
+void DrawingVisual::DropDrawing()
+{
+    delete drawing_;
+    drawing_ = nullptr;
+}
+
 QRectF DrawingVisual::boundingRect() const
 {
     return drawing_ ? QRectF(drawing_->Bounds()) : QRectF();
@@ -64,8 +88,13 @@ void DrawingVisual::paint(QPainter *painter, const QStyleOptionGraphicsItem *, Q
 {
     //qDebug() << "DrawingVisual::paint" << this->boundingRect() << painter->clipRegion();
     if (drawing_) {
+        LatencyTrace::Scope trace(LatencyTrace::Paint);
         drawing_->Draw(*painter);
     }
+    if (inputStamp_ >= 0) {
+        LatencyTrace::MarkOutput(LatencyTrace::InputToPaint, inputStamp_);
+        inputStamp_ = -1;
+    }
 }
 
 INKCANVAS_END_NAMESPACE
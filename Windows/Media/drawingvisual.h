@@ -3,6 +3,8 @@
 
 #include "containervisual.h"
 
+#include <cstdint>
+
 // namespace System.Windows.Media
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -23,13 +25,34 @@ public:
 
     DrawingGroup * GetDrawing();
 
+    /// <summary>
+    /// Arrival stamp of the input packet this visual shows, see
+    /// LatencyTrace::MarkInput. InputToPaint ends at the first paint after it.
+    /// </summary>
+    void SetInputStamp(int64_t stamp);
+
 public:
     virtual QRectF boundingRect() const override;
 
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget = nullptr) override;
 
+protected:
+    /// <summary>
+    /// RenderOpen for a drawing of unchanged bounds, as one drawn again from
+    /// paint; no geometry change, so no further repaint is scheduled
+    /// </summary>
+    DrawingContext * RenderOpenInPlace();
+
+    /// <summary>
+    /// Deletes the drawing without a geometry change, for derived visuals
+    /// that keep reporting its bounds until they render again
+    /// </summary>
+    void DropDrawing();
+
 private:
     DrawingGroup * drawing_ = nullptr;
+    int64_t inputStamp_ = -1;
+    bool inPlace_ = false;
 };
 
 INKCANVAS_END_NAMESPACE
@@ -37,6 +37,21 @@ bool Geometry::releaseOwn(void *owner)
     return owner_ == nullptr;
 }
 
+size_t Geometry::ByteSize()
+{
+    return sizeof(Geometry);
+}
+
+void Geometry::addUser()
+{
+    ++users_;
+}
+
+int Geometry::removeUser()
+{
+    return --users_;
+}
+
 #ifdef INKCANVAS_QT
 
 PathGeometry::PathGeometry()
@@ -92,6 +107,14 @@ Rect GeometryGroup::Bounds()
     return bounds;
 }
 
+size_t GeometryGroup::ByteSize()
+{
+    size_t size = sizeof(GeometryGroup);
+    for (Geometry* g : children_)
+        size += g->ByteSize();
+    return size;
+}
+
 #ifdef INKCANVAS_QT_DRAW
 void GeometryGroup::Draw(QPainter &painter)
 {
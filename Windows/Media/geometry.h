@@ -45,12 +45,28 @@ public:
     virtual void Draw(QPainter& painter) = 0;
 #endif
 
+    /// <summary>
+    /// Approximate memory held by the geometry, for cache budgets
+    /// </summary>
+    virtual size_t ByteSize();
+
     bool tryTakeOwn(void * owner);
 
     bool releaseOwn(void * owner);
 
+    /// <summary>
+    /// Drawings that show the geometry register as users, an owner that
+    /// drops the geometry while it has users leaves it to the last of them
+    /// </summary>
+    void addUser();
+
+    int removeUser();
+
+    int userCount() const { return users_; }
+
 private:
     void * owner_ = nullptr;
+    int users_ = 0;
 };
 
 #ifdef INKCANVAS_QT
@@ -87,6 +103,8 @@ public:
 
     virtual Rect Bounds() override;
 
+    virtual size_t ByteSize() override;
+
 #ifdef INKCANVAS_QT_DRAW
     virtual void Draw(QPainter& painter) override;
 #endif
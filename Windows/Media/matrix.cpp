@@ -1,6 +1,11 @@
 #include "matrix.h"
 #include "Internal/debug.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define INKCANVAS_MATRIX_SSE2 1
+#include <emmintrin.h>
+#endif
+
 INKCANVAS_BEGIN_NAMESPACE
 
 Matrix Matrix::s_identity = CreateIdentity();
@@ -35,4 +40,90 @@ void Matrix::Debug_CheckType()
     }
 }
 
+void Matrix::Transform(double * x, double * y, int count) const
+{
+    int i = 0;
+    switch (_type)
+    {
+    case MatrixTypes::TRANSFORM_IS_IDENTITY:
+        return;
+    case MatrixTypes::TRANSFORM_IS_TRANSLATION:
+    {
+#if INKCANVAS_MATRIX_SSE2
+        __m128d ox = _mm_set1_pd(_offsetX), oy = _mm_set1_pd(_offsetY);
+        for (; i + 2 <= count; i += 2)
+        {
+            _mm_storeu_pd(x + i, _mm_add_pd(_mm_loadu_pd(x + i), ox));
+            _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), oy));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            x[i] += _offsetX;
+            y[i] += _offsetY;
+        }
+        return;
+    }
+    case MatrixTypes::TRANSFORM_IS_SCALING:
+    {
+#if INKCANVAS_MATRIX_SSE2
+        __m128d m11 = _mm_set1_pd(_m11), m22 = _mm_set1_pd(_m22);
+        for (; i + 2 <= count; i += 2)
+        {
+            _mm_storeu_pd(x + i, _mm_mul_pd(_mm_loadu_pd(x + i), m11));
+            _mm_storeu_pd(y + i, _mm_mul_pd(_mm_loadu_pd(y + i), m22));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            x[i] *= _m11;
+            y[i] *= _m22;
+        }
+        return;
+    }
+    case MatrixTypes::TRANSFORM_IS_SCALING_TRANSLATION:
+    {
+#if INKCANVAS_MATRIX_SSE2
+        __m128d m11 = _mm_set1_pd(_m11), m22 = _mm_set1_pd(_m22);
+        __m128d ox = _mm_set1_pd(_offsetX), oy = _mm_set1_pd(_offsetY);
+        for (; i + 2 <= count; i += 2)
+        {
+            _mm_storeu_pd(x + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(x + i), m11), ox));
+            _mm_storeu_pd(y + i, _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(y + i), m22), oy));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            x[i] *= _m11;
+            x[i] += _offsetX;
+            y[i] *= _m22;
+            y[i] += _offsetY;
+        }
+        return;
+    }
+    default:
+    {
+        // Same order of operations as MultiplyPoint
+#if INKCANVAS_MATRIX_SSE2
+        __m128d m11 = _mm_set1_pd(_m11), m12 = _mm_set1_pd(_m12);
+        __m128d m21 = _mm_set1_pd(_m21), m22 = _mm_set1_pd(_m22);
+        __m128d ox = _mm_set1_pd(_offsetX), oy = _mm_set1_pd(_offsetY);
+        for (; i + 2 <= count; i += 2)
+        {
+            __m128d px = _mm_loadu_pd(x + i), py = _mm_loadu_pd(y + i);
+            __m128d xadd = _mm_add_pd(_mm_mul_pd(py, m21), ox);
+            __m128d yadd = _mm_add_pd(_mm_mul_pd(px, m12), oy);
+            _mm_storeu_pd(x + i, _mm_add_pd(_mm_mul_pd(px, m11), xadd));
+            _mm_storeu_pd(y + i, _mm_add_pd(_mm_mul_pd(py, m22), yadd));
+        }
+#endif
+        for (; i < count; i++)
+        {
+            MultiplyPoint(x[i], y[i]);
+        }
+        return;
+    }
+    }
+}
+
 INKCANVAS_END_NAMESPACE
@@ -410,6 +410,14 @@ public:
         }
     }
 
+    /// <summary>
+    /// Transform - Transforms count points given as separate x and y arrays
+    /// in place. The loop is picked once by the matrix type and runs two
+    /// points at a time where SSE2 is available, with the same results as
+    /// transforming each point.
+    /// </summary>
+    void Transform(double * x, double * y, int count) const;
+
     Rect Transform(Rect const & rect) const
     {
         Rect result = rect;
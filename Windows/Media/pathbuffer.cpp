@@ -0,0 +1,115 @@
+#include "Windows/Media/pathbuffer.h"
+#include "Windows/Media/streamgeometrycontext.h"
+
+#include <cstring>
+#include <cstdint>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+int PathBuffer::CoordCount(Op op)
+{
+    static int const counts[] = { 2, 2, 4, 6, 7, 0 };
+    return counts[op];
+}
+
+void PathBuffer::Clear()
+{
+    ops_.clear();
+    coords_.clear();
+}
+
+void PathBuffer::Add(Op op, float const * coords)
+{
+    ops_.push_back(op);
+    coords_.insert(coords_.end(), coords, coords + CoordCount(op));
+}
+
+Rect PathBuffer::Bounds() const
+{
+    Rect bounds = Rect::Empty();
+    Point start, current;
+    size_t c = 0;
+    for (unsigned char op : ops_)
+    {
+        int n = CoordCount(static_cast<Op>(op));
+        float const * a = coords_.data() + c;
+        // arcs may bulge out of their end points, the control points of
+        // the beziers approximating them enclose the arc
+        if (op == ArcTo)
+        {
+            List<Point> bezierPoints;
+            StreamGeometryContext::ArcToBezier(current, Point(a[0], a[1]), Size(a[2], a[3]), a[4], a[5] != 0,
+                    a[6] != 0 ? SweepDirection::Clockwise : SweepDirection::Counterclockwise, bezierPoints);
+            for (Point const & pt : bezierPoints)
+                bounds.Union(pt);
+            bounds.Union(Point(a[0], a[1]));
+        }
+        else
+        {
+            for (int i = 0; i < n; i += 2)
+                bounds.Union(Point(a[i], a[i + 1]));
+        }
+        if (op == MoveTo)
+            start = Point(a[0], a[1]);
+        if (op == Close)
+            current = start;
+        else if (op == ArcTo)
+            current = Point(a[0], a[1]);
+        else
+            current = Point(a[n - 2], a[n - 1]);
+        c += n;
+    }
+    return bounds;
+}
+
+size_t PathBuffer::ByteSize() const
+{
+    return sizeof(int32_t) * 2 + coords_.size() * sizeof(float) + ops_.size();
+}
+
+void PathBuffer::Serialize(void * data) const
+{
+    char * p = static_cast<char*>(data);
+    int32_t counts[2] = { static_cast<int32_t>(ops_.size()), static_cast<int32_t>(coords_.size()) };
+    memcpy(p, counts, sizeof(counts));
+    p += sizeof(counts);
+    memcpy(p, coords_.data(), coords_.size() * sizeof(float));
+    p += coords_.size() * sizeof(float);
+    memcpy(p, ops_.data(), ops_.size());
+}
+
+void PathBuffer::Replay(StreamGeometryContext & context) const
+{
+    float const * c = coords_.data();
+    bool started = false;
+    for (unsigned char op : ops_)
+    {
+        switch (op)
+        {
+        case MoveTo:
+            context.BeginFigure(Point(c[0], c[1]), true, false);
+            started = true;
+            break;
+        case LineTo:
+            context.LineTo(Point(c[0], c[1]), true, false);
+            break;
+        case QuadTo:
+            context.QuadraticBezierTo(Point(c[0], c[1]), Point(c[2], c[3]), true, false);
+            break;
+        case CubicTo:
+            context.BezierTo(Point(c[0], c[1]), Point(c[2], c[3]), Point(c[4], c[5]), true, false);
+            break;
+        case ArcTo:
+            context.ArcTo(Point(c[0], c[1]), Size(c[2], c[3]), c[4], c[5] != 0,
+                    c[6] != 0 ? SweepDirection::Clockwise : SweepDirection::Counterclockwise, true, false);
+            break;
+        case Close:
+            if (started)
+                context.SetClosedState(true);
+            break;
+        }
+        c += CoordCount(static_cast<Op>(op));
+    }
+}
+
+INKCANVAS_END_NAMESPACE
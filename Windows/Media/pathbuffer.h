@@ -0,0 +1,83 @@
+#ifndef WINDOWS_MEDIA_PATHBUFFER_H
+#define WINDOWS_MEDIA_PATHBUFFER_H
+
+#include "InkCanvas_global.h"
+#include "Windows/rect.h"
+
+#include <vector>
+
+// namespace System.Windows.Media
+INKCANVAS_BEGIN_NAMESPACE
+
+class StreamGeometryContext;
+
+/// <summary>
+/// A compact recording of path figures: one opcode byte per segment and the
+/// coordinates of all segments in one contiguous float array, so a whole
+/// outline can be handed across FFI boundaries with a single copy.
+///
+/// Serialized layout (native endian):
+///   int32 opCount, int32 coordCount, float coords[coordCount], uint8 ops[opCount]
+/// </summary>
+class PathBuffer
+{
+public:
+    enum Op : unsigned char
+    {
+        MoveTo = 0,     // x, y
+        LineTo = 1,     // x, y
+        QuadTo = 2,     // x1, y1, x2, y2
+        CubicTo = 3,    // x1, y1, x2, y2, x3, y3
+        ArcTo = 4,      // x, y, rx, ry, rotationAngle, isLargeArc, isClockwise
+        Close = 5,      //
+    };
+
+    /// <summary>
+    /// Number of coordinates that follow op
+    /// </summary>
+    static int CoordCount(Op op);
+
+public:
+    void Clear();
+
+    bool IsEmpty() const { return ops_.empty(); }
+
+    void Add(Op op, float const * coords);
+
+    int OpCount() const { return static_cast<int>(ops_.size()); }
+
+    unsigned char const * Ops() const { return ops_.data(); }
+
+    int CoordCount() const { return static_cast<int>(coords_.size()); }
+
+    float const * Coords() const { return coords_.data(); }
+
+    /// <summary>
+    /// Bounds of all coordinates, control points included, arcs are
+    /// bounded by the control points of their bezier approximation
+    /// </summary>
+    Rect Bounds() const;
+
+    /// <summary>
+    /// Size in bytes of the serialized layout
+    /// </summary>
+    size_t ByteSize() const;
+
+    /// <summary>
+    /// Writes the serialized layout to data, which must hold ByteSize() bytes
+    /// </summary>
+    void Serialize(void * data) const;
+
+    /// <summary>
+    /// Plays the figures back into another context, e.g. a ScanlineRasterizer
+    /// </summary>
+    void Replay(StreamGeometryContext & context) const;
+
+private:
+    std::vector<unsigned char> ops_;
+    std::vector<float> coords_;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_MEDIA_PATHBUFFER_H
@@ -0,0 +1,110 @@
+#include "Windows/Media/pathbufferstreamgeometrycontext.h"
+#include "Windows/Media/streamgeometry.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+PathBufferStreamGeometryContext::PathBufferStreamGeometryContext(PathBuffer & buffer, bool flattenArcs)
+    : buffer_(&buffer)
+    , flattenArcs_(flattenArcs)
+{
+}
+
+PathBufferStreamGeometryContext::PathBufferStreamGeometryContext(StreamGeometry * geometry, bool flattenArcs)
+    : geometry_(geometry)
+    , buffer_(&ownBuffer_)
+    , flattenArcs_(flattenArcs)
+{
+}
+
+void PathBufferStreamGeometryContext::BeginFigure(const Point &startPoint, bool, bool isClosed)
+{
+    EndFigure();
+    isStarted_ = true;
+    isClosed_ = isClosed;
+    float c[] = { static_cast<float>(startPoint.X()), static_cast<float>(startPoint.Y()) };
+    buffer_->Add(PathBuffer::MoveTo, c);
+    lastPoint_ = startPoint;
+}
+
+void PathBufferStreamGeometryContext::LineTo(const Point &point, bool, bool)
+{
+    float c[] = { static_cast<float>(point.X()), static_cast<float>(point.Y()) };
+    buffer_->Add(PathBuffer::LineTo, c);
+    lastPoint_ = point;
+}
+
+void PathBufferStreamGeometryContext::QuadraticBezierTo(const Point &point1, const Point &point2, bool, bool)
+{
+    float c[] = { static_cast<float>(point1.X()), static_cast<float>(point1.Y()),
+                  static_cast<float>(point2.X()), static_cast<float>(point2.Y()) };
+    buffer_->Add(PathBuffer::QuadTo, c);
+    lastPoint_ = point2;
+}
+
+void PathBufferStreamGeometryContext::BezierTo(const Point &point1, const Point &point2, const Point &point3, bool, bool)
+{
+    float c[] = { static_cast<float>(point1.X()), static_cast<float>(point1.Y()),
+                  static_cast<float>(point2.X()), static_cast<float>(point2.Y()),
+                  static_cast<float>(point3.X()), static_cast<float>(point3.Y()) };
+    buffer_->Add(PathBuffer::CubicTo, c);
+    lastPoint_ = point3;
+}
+
+void PathBufferStreamGeometryContext::PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (Point const & pt : points) {
+        LineTo(pt, isStroked, isSmoothJoin);
+    }
+}
+
+void PathBufferStreamGeometryContext::PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (int i = 0; i + 1 < points.Count(); i += 2) {
+        QuadraticBezierTo(points[i], points[i + 1], isStroked, isSmoothJoin);
+    }
+}
+
+void PathBufferStreamGeometryContext::PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (int i = 0; i + 2 < points.Count(); i += 3) {
+        BezierTo(points[i], points[i + 1], points[i + 2], isStroked, isSmoothJoin);
+    }
+}
+
+void PathBufferStreamGeometryContext::ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin)
+{
+    if (flattenArcs_)
+    {
+        List<Point> points;
+        ArcToBezier(lastPoint_, point, size, rotationAngle, isLargeArc, sweepDirection, points);
+        PolyBezierTo(points, isStroked, isSmoothJoin);
+        return;
+    }
+    float c[] = { static_cast<float>(point.X()), static_cast<float>(point.Y()),
+                  static_cast<float>(size.Width()), static_cast<float>(size.Height()),
+                  static_cast<float>(rotationAngle), isLargeArc ? 1.0f : 0.0f,
+                  sweepDirection == SweepDirection::Clockwise ? 1.0f : 0.0f };
+    buffer_->Add(PathBuffer::ArcTo, c);
+    lastPoint_ = point;
+}
+
+void PathBufferStreamGeometryContext::SetClosedState(bool closed)
+{
+    isClosed_ = closed;
+}
+
+void PathBufferStreamGeometryContext::DisposeCore()
+{
+    EndFigure();
+    if (geometry_)
+        geometry_->Close(buffer_);
+}
+
+void PathBufferStreamGeometryContext::EndFigure()
+{
+    if (isStarted_ && isClosed_)
+        buffer_->Add(PathBuffer::Close, nullptr);
+    isStarted_ = false;
+}
+
+INKCANVAS_END_NAMESPACE
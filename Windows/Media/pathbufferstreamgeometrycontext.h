@@ -0,0 +1,58 @@
+#ifndef WINDOWS_MEDIA_PATHBUFFERSTREAMGEOMETRYCONTEXT_H
+#define WINDOWS_MEDIA_PATHBUFFERSTREAMGEOMETRYCONTEXT_H
+
+#include "Windows/Media/streamgeometrycontext.h"
+#include "Windows/Media/pathbuffer.h"
+
+// namespace System.Windows.Media
+INKCANVAS_BEGIN_NAMESPACE
+
+class StreamGeometry;
+
+/// <summary>
+/// Platform neutral StreamGeometryContext that records into a PathBuffer.
+/// With flattenArcs, ArcTo is recorded as CubicTo segments, for hosts whose
+/// path types have no SVG style elliptical arcs.
+/// </summary>
+class PathBufferStreamGeometryContext : public StreamGeometryContext
+{
+public:
+    /// <summary>
+    /// Records into buffer, which is not cleared
+    /// </summary>
+    PathBufferStreamGeometryContext(PathBuffer & buffer, bool flattenArcs = false);
+
+    /// <summary>
+    /// Records into a buffer of its own, handed to geometry on Close
+    /// </summary>
+    PathBufferStreamGeometryContext(StreamGeometry * geometry, bool flattenArcs = false);
+
+    // StreamGeometryContext interface
+public:
+    virtual void BeginFigure(const Point &startPoint, bool isFilled, bool isClosed) override;
+    virtual void LineTo(const Point &point, bool isStroked, bool isSmoothJoin) override;
+    virtual void QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin) override;
+    virtual void BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin) override;
+    virtual void SetClosedState(bool closed) override;
+    virtual void DisposeCore() override;
+
+private:
+    void EndFigure();
+
+private:
+    StreamGeometry * geometry_ = nullptr;
+    PathBuffer ownBuffer_;
+    PathBuffer * buffer_;
+    bool flattenArcs_;
+    bool isStarted_ = false;
+    bool isClosed_ = false;
+    Point lastPoint_;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_MEDIA_PATHBUFFERSTREAMGEOMETRYCONTEXT_H
@@ -0,0 +1,268 @@
+#include "Windows/Media/scanlinerasterizer.h"
+#include "cmath.h"
+
+#include <algorithm>
+
+INKCANVAS_BEGIN_NAMESPACE
+
+ScanlineRasterizer::ScanlineRasterizer()
+{
+}
+
+void ScanlineRasterizer::SetTransform(Matrix const & transform)
+{
+    transform_ = transform;
+}
+
+void ScanlineRasterizer::Reset()
+{
+    edges_.clear();
+    inFigure_ = false;
+}
+
+void ScanlineRasterizer::BeginFigure(const Point &startPoint, bool, bool)
+{
+    CloseFigure();
+    lastPoint_ = startPoint;
+    figureStart_ = current_ = transform_.Transform(startPoint);
+    inFigure_ = true;
+}
+
+void ScanlineRasterizer::LineTo(const Point &point, bool, bool)
+{
+    lastPoint_ = point;
+    AddEdge(transform_.Transform(point));
+}
+
+void ScanlineRasterizer::QuadraticBezierTo(const Point &point1, const Point &point2, bool, bool)
+{
+    lastPoint_ = point2;
+    Point p0 = current_;
+    Point p1 = transform_.Transform(point1);
+    Point p2 = transform_.Transform(point2);
+    // deviation of uniform subdivision into n lines is |p0 - 2p1 + p2| / (4 n^2)
+    double dd = ((p0 - p1) - (p1 - p2)).Length();
+    int n = static_cast<int>(std::ceil(Math::Sqrt(dd / (4 * FlatteningTolerance))));
+    n = std::max(1, std::min(n, 100));
+    for (int i = 1; i < n; ++i)
+    {
+        double t = static_cast<double>(i) / n, s = 1 - t;
+        AddEdge(Point(s * s * p0.X() + 2 * s * t * p1.X() + t * t * p2.X(),
+                      s * s * p0.Y() + 2 * s * t * p1.Y() + t * t * p2.Y()));
+    }
+    AddEdge(p2);
+}
+
+void ScanlineRasterizer::BezierTo(const Point &point1, const Point &point2, const Point &point3, bool, bool)
+{
+    lastPoint_ = point3;
+    Point p0 = current_;
+    Point p1 = transform_.Transform(point1);
+    Point p2 = transform_.Transform(point2);
+    Point p3 = transform_.Transform(point3);
+    // deviation of uniform subdivision into n lines is bounded by 3/4 max|second difference| / n^2
+    double dd = std::max(((p0 - p1) - (p1 - p2)).Length(), ((p1 - p2) - (p2 - p3)).Length());
+    int n = static_cast<int>(std::ceil(Math::Sqrt(0.75 * dd / FlatteningTolerance)));
+    n = std::max(1, std::min(n, 100));
+    for (int i = 1; i < n; ++i)
+    {
+        double t = static_cast<double>(i) / n, s = 1 - t;
+        double a = s * s * s, b = 3 * s * s * t, c = 3 * s * t * t, d = t * t * t;
+        AddEdge(Point(a * p0.X() + b * p1.X() + c * p2.X() + d * p3.X(),
+                      a * p0.Y() + b * p1.Y() + c * p2.Y() + d * p3.Y()));
+    }
+    AddEdge(p3);
+}
+
+void ScanlineRasterizer::PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (Point const & pt : points) {
+        LineTo(pt, isStroked, isSmoothJoin);
+    }
+}
+
+void ScanlineRasterizer::PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (int i = 0; i + 1 < points.Count(); i += 2) {
+        QuadraticBezierTo(points[i], points[i + 1], isStroked, isSmoothJoin);
+    }
+}
+
+void ScanlineRasterizer::PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (int i = 0; i + 2 < points.Count(); i += 3) {
+        BezierTo(points[i], points[i + 1], points[i + 2], isStroked, isSmoothJoin);
+    }
+}
+
+void ScanlineRasterizer::ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin)
+{
+    List<Point> points;
+    ArcToBezier(lastPoint_, point, size, rotationAngle, isLargeArc, sweepDirection, points);
+    PolyBezierTo(points, isStroked, isSmoothJoin);
+}
+
+void ScanlineRasterizer::SetClosedState(bool)
+{
+    // Filling always closes figures
+}
+
+void ScanlineRasterizer::Close()
+{
+    CloseFigure();
+    StreamGeometryContext::Close();
+}
+
+void ScanlineRasterizer::CloseFigure()
+{
+    if (inFigure_)
+        AddEdge(figureStart_);
+    inFigure_ = false;
+}
+
+void ScanlineRasterizer::AddEdge(Point const & to)
+{
+    Point from = current_;
+    current_ = to;
+    if (from.Y() == to.Y())
+        return; // horizontal edges don't contribute
+    Edge edge;
+    if (from.Y() < to.Y())
+    {
+        edge.x0 = from.X(); edge.y0 = from.Y();
+        edge.x1 = to.X(); edge.y1 = to.Y();
+        edge.dir = 1;
+    }
+    else
+    {
+        edge.x0 = to.X(); edge.y0 = to.Y();
+        edge.x1 = from.X(); edge.y1 = from.Y();
+        edge.dir = -1;
+    }
+    edge.dxdy = (edge.x1 - edge.x0) / (edge.y1 - edge.y0);
+    edges_.push_back(edge);
+}
+
+void ScanlineRasterizer::Rasterize(int width, int height, SpanHandler const & handler)
+{
+    CloseFigure();
+    if (edges_.empty() || width <= 0 || height <= 0)
+        return;
+    std::sort(edges_.begin(), edges_.end(), [](Edge const & l, Edge const & r) {
+        return l.y0 < r.y0;
+    });
+    double bottom = edges_.front().y1;
+    for (Edge const & edge : edges_)
+        bottom = std::max(bottom, edge.y1);
+    int y = std::max(0, static_cast<int>(std::floor(edges_.front().y0)));
+    int y1 = std::min(height, static_cast<int>(std::ceil(bottom)));
+    accumulation_.assign(static_cast<size_t>(width) + 2, 0.0f);
+    coverage_.resize(static_cast<size_t>(width));
+    std::vector<Edge const *> active;
+    size_t next = 0;
+    for (; y < y1; ++y)
+    {
+        double top = y;
+        // retire edges above this row, take in edges starting within it
+        active.erase(std::remove_if(active.begin(), active.end(), [top](Edge const * edge) {
+            return edge->y1 <= top;
+        }), active.end());
+        while (next < edges_.size() && edges_[next].y0 < top + 1)
+        {
+            if (edges_[next].y1 > top)
+                active.push_back(&edges_[next]);
+            ++next;
+        }
+        if (active.empty())
+            continue;
+        double left = width, right = 0;
+        for (Edge const * edge : active)
+        {
+            AccumulateRow(*edge, top, width);
+            left = std::min(left, std::min(edge->x0 + (std::max(edge->y0, top) - edge->y0) * edge->dxdy,
+                                           edge->x0 + (std::min(edge->y1, top + 1) - edge->y0) * edge->dxdy));
+            right = std::max(right, std::max(edge->x0 + (std::max(edge->y0, top) - edge->y0) * edge->dxdy,
+                                             edge->x0 + (std::min(edge->y1, top + 1) - edge->y0) * edge->dxdy));
+        }
+        // the winding sum of closed figures is back to zero right of the last edge
+        int x0 = std::max(0, std::min(width - 1, static_cast<int>(std::floor(left))));
+        int x1 = std::max(x0, std::min(width, static_cast<int>(std::ceil(right)) + 1));
+        // everything left of the image was accumulated into [0]
+        float winding = 0;
+        for (int x = 0; x < x0; ++x)
+        {
+            winding += accumulation_[static_cast<size_t>(x)];
+            accumulation_[static_cast<size_t>(x)] = 0;
+        }
+        bool any = false;
+        for (int x = x0; x < x1; ++x)
+        {
+            winding += accumulation_[static_cast<size_t>(x)];
+            accumulation_[static_cast<size_t>(x)] = 0;
+            float c = std::min(1.0f, std::abs(winding));
+            coverage_[static_cast<size_t>(x)] = c;
+            any = any || c > 0;
+        }
+        accumulation_[static_cast<size_t>(x1)] = 0;
+        accumulation_[static_cast<size_t>(x1) + 1] = 0;
+        if (any)
+            handler(y, x0, x1 - x0, &coverage_[static_cast<size_t>(x0)]);
+    }
+}
+
+// Accumulates the signed area the part of edge within scanline [top, top + 1)
+//  covers right of it; the running sum along the scanline is then the winding
+//  number weighted by coverage.
+void ScanlineRasterizer::AccumulateRow(Edge const & edge, double top, int width)
+{
+    double ya = std::max(edge.y0, top), yb = std::min(edge.y1, top + 1);
+    if (ya >= yb)
+        return;
+    double xa = edge.x0 + (ya - edge.y0) * edge.dxdy;
+    double xb = edge.x0 + (yb - edge.y0) * edge.dxdy;
+    if (xa > xb)
+        std::swap(xa, xb);
+    double d = (yb - ya) * edge.dir;
+    float * acc = accumulation_.data();
+    if (xb <= 0)
+    {
+        acc[0] += static_cast<float>(d);
+        return;
+    }
+    if (xa >= width)
+        return;
+    if (xa < 0)
+    {
+        // the part left of the image covers the whole scanline
+        double dl = d * (0 - xa) / (xb - xa);
+        acc[0] += static_cast<float>(dl);
+        d -= dl;
+        xa = 0;
+    }
+    if (xb > width)
+    {
+        d = d * (width - xa) / (xb - xa);
+        xb = width;
+    }
+    int i0 = std::min(static_cast<int>(xa), width - 1);
+    int i1 = std::min(static_cast<int>(xb), width - 1);
+    if (i0 == i1)
+    {
+        double xm = (xa + xb) / 2 - i0;
+        acc[i0] += static_cast<float>(d * (1 - xm));
+        acc[i0 + 1] += static_cast<float>(d * xm);
+        return;
+    }
+    double dPerX = d / (xb - xa);
+    for (int i = i0; i <= i1; ++i)
+    {
+        double l = std::max(xa, static_cast<double>(i));
+        double r = std::min(xb, static_cast<double>(i + 1));
+        double di = dPerX * (r - l);
+        double xm = (l + r) / 2 - i;
+        acc[i] += static_cast<float>(di * (1 - xm));
+        acc[i + 1] += static_cast<float>(di * xm);
+    }
+}
+
+INKCANVAS_END_NAMESPACE
@@ -0,0 +1,98 @@
+#ifndef WINDOWS_MEDIA_SCANLINERASTERIZER_H
+#define WINDOWS_MEDIA_SCANLINERASTERIZER_H
+
+#include "Windows/Media/streamgeometrycontext.h"
+#include "Windows/Media/matrix.h"
+
+#include <functional>
+#include <vector>
+
+// namespace System.Windows.Media
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// A StreamGeometryContext that flattens the figures it receives into edges
+/// and fills them scanline by scanline, with the non-zero fill rule and
+/// analytic area anti-aliasing. It has no dependency on any graphics stack,
+/// so it works in INKCANVAS_CORE builds where there is no DrawingContext.
+/// </summary>
+class ScanlineRasterizer : public StreamGeometryContext
+{
+public:
+    /// <summary>
+    /// Receives the coverage of one scanline, coverage[i] in [0, 1] for
+    /// pixel (x + i, y), count pixels
+    /// </summary>
+    typedef std::function<void(int y, int x, int count, float const * coverage)> SpanHandler;
+
+    ScanlineRasterizer();
+
+    /// <summary>
+    /// Transform from geometry to pixel coordinates, applies to figures added afterwards
+    /// </summary>
+    void SetTransform(Matrix const & transform);
+
+    /// <summary>
+    /// Forgets all figures added so far
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// True when no edges have been added since last Reset
+    /// </summary>
+    bool IsEmpty() const { return edges_.empty(); }
+
+    /// <summary>
+    /// Fills the figures added so far, clipped to [0, width) x [0, height).
+    /// Scanlines are reported top-down, spans without coverage are skipped.
+    /// </summary>
+    void Rasterize(int width, int height, SpanHandler const & handler);
+
+    // StreamGeometryContext interface
+public:
+    virtual void BeginFigure(const Point &startPoint, bool isFilled, bool isClosed) override;
+    virtual void LineTo(const Point &point, bool isStroked, bool isSmoothJoin) override;
+    virtual void QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin) override;
+    virtual void BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin) override;
+    virtual void SetClosedState(bool closed) override;
+    virtual void Close() override;
+
+private:
+    /// <summary>
+    /// Maximum deviation of flattened curves, in pixels
+    /// </summary>
+    static constexpr double FlatteningTolerance = 0.1;
+
+    struct Edge
+    {
+        double x0, y0; // top
+        double x1, y1; // bottom
+        double dxdy;
+        float dir; // +1 downward, -1 upward
+    };
+
+    void AddEdge(Point const & to);
+
+    void CloseFigure();
+
+    void AccumulateRow(Edge const & edge, double top, int width);
+
+    Matrix transform_;
+    std::vector<Edge> edges_;
+    // pixel coordinates
+    Point figureStart_;
+    Point current_;
+    // geometry coordinates, as ArcTo need the untransformed start
+    Point lastPoint_;
+    bool inFigure_ = false;
+    std::vector<float> accumulation_;
+    std::vector<float> coverage_;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_MEDIA_SCANLINERASTERIZER_H
@@ -0,0 +1,373 @@
+#include "Windows/Media/simplifyingstreamgeometrycontext.h"
+#include "Internal/doubleutil.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+static double DistanceSquaredToSegment(Point const & point, Point const & start, Point const & end)
+{
+    Vector segment = end - start;
+    Vector offset = point - start;
+    double lengthSquared = segment.LengthSquared();
+    if (lengthSquared > 0)
+    {
+        double t = (offset * segment) / lengthSquared;
+        if (t >= 1)
+            offset = point - end;
+        else if (t > 0)
+            offset = offset - segment * t;
+    }
+    return offset.LengthSquared();
+}
+
+static Point BezierPoint(Point const & p0, Point const & p1, Point const & p2, Point const & p3, double u)
+{
+    double v = 1 - u;
+    double b0 = v * v * v, b1 = 3 * u * v * v, b2 = 3 * u * u * v, b3 = u * u * u;
+    return Point(b0 * p0.X() + b1 * p1.X() + b2 * p2.X() + b3 * p3.X(),
+                 b0 * p0.Y() + b1 * p1.Y() + b2 * p2.Y() + b3 * p3.Y());
+}
+
+// One Newton step from u towards the parameter of the point on the curve nearest to point
+static double NearestParameter(Point const & p0, Point const & p1, Point const & p2, Point const & p3,
+                               Point const & point, double u)
+{
+    double v = 1 - u;
+    Vector d = BezierPoint(p0, p1, p2, p3, u) - point;
+    // first and second derivatives
+    Vector d1 = (p1 - p0) * (3 * v * v) + (p2 - p1) * (6 * u * v) + (p3 - p2) * (3 * u * u);
+    Vector d2 = (Vector(p2) - Vector(p1) * 2 + Vector(p0)) * (6 * v) + (Vector(p3) - Vector(p2) * 2 + Vector(p1)) * (6 * u);
+    double denominator = d1 * d1 + d * d2;
+    if (DoubleUtil::IsZero(denominator))
+        return u;
+    double next = u - (d * d1) / denominator;
+    return next < 0 ? 0 : next > 1 ? 1 : next;
+}
+
+SimplifyingStreamGeometryContext::SimplifyingStreamGeometryContext(StreamGeometryContext & target, double tolerance)
+    : target_(target)
+    , tolerance_(tolerance)
+{
+}
+
+void SimplifyingStreamGeometryContext::BeginFigure(const Point &startPoint, bool isFilled, bool isClosed)
+{
+    Flush();
+    target_.BeginFigure(startPoint, isFilled, isClosed);
+    StartRun(startPoint);
+}
+
+void SimplifyingStreamGeometryContext::LineTo(const Point &point, bool isStroked, bool isSmoothJoin)
+{
+    AddToRun(point, isStroked, isSmoothJoin);
+}
+
+void SimplifyingStreamGeometryContext::QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin)
+{
+    Flush();
+    target_.QuadraticBezierTo(point1, point2, isStroked, isSmoothJoin);
+    StartRun(point2);
+}
+
+void SimplifyingStreamGeometryContext::BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin)
+{
+    Flush();
+    target_.BezierTo(point1, point2, point3, isStroked, isSmoothJoin);
+    StartRun(point3);
+}
+
+void SimplifyingStreamGeometryContext::PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    for (Point const & pt : points) {
+        AddToRun(pt, isStroked, isSmoothJoin);
+    }
+}
+
+void SimplifyingStreamGeometryContext::PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    Flush();
+    target_.PolyQuadraticBezierTo(points, isStroked, isSmoothJoin);
+    if (points.Count() > 0)
+        StartRun(points[points.Count() - 1]);
+}
+
+void SimplifyingStreamGeometryContext::PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    Flush();
+    target_.PolyBezierTo(points, isStroked, isSmoothJoin);
+    if (points.Count() > 0)
+        StartRun(points[points.Count() - 1]);
+}
+
+void SimplifyingStreamGeometryContext::ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin)
+{
+    Flush();
+    target_.ArcTo(point, size, rotationAngle, isLargeArc, sweepDirection, isStroked, isSmoothJoin);
+    StartRun(point);
+}
+
+void SimplifyingStreamGeometryContext::SetClosedState(bool closed)
+{
+    Flush();
+    target_.SetClosedState(closed);
+}
+
+void SimplifyingStreamGeometryContext::DisposeCore()
+{
+    Flush();
+}
+
+void SimplifyingStreamGeometryContext::AddToRun(Point const & point, bool isStroked, bool isSmoothJoin)
+{
+    if (run_.Count() == 0)
+    {
+        // No current point to simplify from
+        target_.LineTo(point, isStroked, isSmoothJoin);
+        return;
+    }
+    if (isStroked != isStroked_ || isSmoothJoin != isSmoothJoin_)
+    {
+        Flush();
+        isStroked_ = isStroked;
+        isSmoothJoin_ = isSmoothJoin;
+    }
+    run_.Add(point);
+}
+
+void SimplifyingStreamGeometryContext::StartRun(Point const & point)
+{
+    run_.Clear();
+    run_.Add(point);
+}
+
+/// <summary>
+/// Passes on the polyline run still held back. The lines from the current
+/// point are thinned out first, then the longest stretches of the remaining
+/// vertices that fit a bezier are replaced by it, at least MinCurveSegments
+/// lines at a time. Each step takes half the tolerance, so the curves only
+/// need to be checked against the thinned out vertices.
+/// </summary>
+void SimplifyingStreamGeometryContext::Flush()
+{
+    int last = run_.Count() - 1;
+    if (last < 1)
+        return;
+
+    keep_.Clear();
+    for (int i = 0; i <= last; i++)
+    {
+        keep_.Add(i == 0 || i == last ? 1 : 0);
+    }
+    SimplifyLines(0, last);
+
+    vertices_.Clear();
+    for (int i = 0; i <= last; i++)
+    {
+        if (keep_[i])
+            vertices_.Add(run_[i]);
+    }
+
+    lines_.Clear();
+    int lastVertex = vertices_.Count() - 1;
+    for (int p = 0; p < lastVertex; )
+    {
+        int curveEnd = -1;
+        Point control1, control2;
+        if (p + MinCurveSegments <= lastVertex)
+        {
+            // end tangents from the vertices on both sides where there are
+            Vector tangent1 = vertices_[p + 1] - vertices_[p > 0 ? p - 1 : p];
+            int maxEnd = p + MaxCurveSegments < lastVertex ? p + MaxCurveSegments : lastVertex;
+            // Grow the stretch by doubling while the curve fits, then
+            // narrow down between the longest fit and the first miss
+            int fits = p, misses = maxEnd + 1;
+            for (int q = p + MinCurveSegments; fits + 1 < misses; )
+            {
+                Vector tangent2 = vertices_[q - 1] - vertices_[q < lastVertex ? q + 1 : q];
+                Point c1, c2;
+                if (FitCurve(p, q, tangent1, tangent2, c1, c2))
+                {
+                    fits = q;
+                    control1 = c1;
+                    control2 = c2;
+                }
+                else
+                {
+                    misses = q;
+                    if (fits == p)
+                        break;
+                }
+                if (misses > maxEnd)
+                    q = 2 * q - p < maxEnd ? 2 * q - p : maxEnd;
+                else
+                    q = (fits + misses) / 2;
+            }
+            if (fits > p)
+                curveEnd = fits;
+        }
+
+        if (curveEnd < 0)
+        {
+            lines_.Add(vertices_[++p]);
+            continue;
+        }
+
+        if (lines_.Count() > 0)
+        {
+            target_.PolyLineTo(lines_, isStroked_, isSmoothJoin_);
+            lines_.Clear();
+        }
+        target_.BezierTo(control1, control2, vertices_[curveEnd], isStroked_, isSmoothJoin_);
+        p = curveEnd;
+    }
+
+    if (lines_.Count() > 0)
+    {
+        target_.PolyLineTo(lines_, isStroked_, isSmoothJoin_);
+        lines_.Clear();
+    }
+
+    StartRun(run_[last]);
+}
+
+/// <summary>
+/// Douglas-Peucker: keeps the vertex farthest from the line between the ends
+/// of a range if it is off by more than half the tolerance, and goes on with
+/// the two halves
+/// </summary>
+void SimplifyingStreamGeometryContext::SimplifyLines(int first, int last)
+{
+    double toleranceSquared = tolerance_ * tolerance_ / 4;
+    pending_.Clear();
+    pending_.Add(first);
+    pending_.Add(last);
+    while (pending_.Count() > 0)
+    {
+        int end = pending_[pending_.Count() - 1];
+        int start = pending_[pending_.Count() - 2];
+        pending_.RemoveRange(pending_.Count() - 2, 2);
+
+        double maxDistance = toleranceSquared;
+        int farthest = -1;
+        for (int i = start + 1; i < end; i++)
+        {
+            double distance = DistanceSquaredToSegment(run_[i], run_[start], run_[end]);
+            if (distance > maxDistance)
+            {
+                maxDistance = distance;
+                farthest = i;
+            }
+        }
+
+        if (farthest >= 0)
+        {
+            keep_[farthest] = 1;
+            pending_.Add(start);
+            pending_.Add(farthest);
+            pending_.Add(farthest);
+            pending_.Add(end);
+        }
+    }
+}
+
+/// <summary>
+/// Least squares fit of the control point distances along the end tangents
+/// (Schneider's fitting). The points start out parameterized by chord
+/// length, a few Newton steps move the parameters to the nearest points of
+/// the curve while the fit is close. The error is measured at each vertex
+/// and at the curve between each two vertices.
+/// </summary>
+bool SimplifyingStreamGeometryContext::FitCurve(int first, int last, Vector const & tangent1, Vector const & tangent2,
+                                                Point & control1, Point & control2)
+{
+    if (DoubleUtil::IsZero(tangent1.LengthSquared()) || DoubleUtil::IsZero(tangent2.LengthSquared()))
+        return false;
+
+    Vector t1 = tangent1, t2 = tangent2;
+    t1.Normalize();
+    t2.Normalize();
+
+    params_.Clear();
+    params_.Add(0);
+    for (int i = first + 1; i <= last; i++)
+    {
+        params_.Add(params_[i - first - 1] + (vertices_[i] - vertices_[i - 1]).Length());
+    }
+    double length = params_[last - first];
+    if (DoubleUtil::IsZero(length))
+        return false;
+    for (int i = first + 1; i <= last; i++)
+    {
+        params_[i - first] /= length;
+    }
+
+    Point const & p0 = vertices_[first];
+    Point const & p3 = vertices_[last];
+    double chord = (p3 - p0).Length();
+    double toleranceSquared = tolerance_ * tolerance_ / 4;
+    for (int iteration = 0; iteration <= MaxReparameterizations; iteration++)
+    {
+        double c00 = 0, c01 = 0, c11 = 0, x0 = 0, x1 = 0;
+        for (int i = first; i <= last; i++)
+        {
+            double u = params_[i - first];
+            double v = 1 - u;
+            double b0 = v * v * v, b1 = 3 * u * v * v, b2 = 3 * u * u * v, b3 = u * u * u;
+            Vector a1 = t1 * b1, a2 = t2 * b2;
+            c00 += a1 * a1;
+            c01 += a1 * a2;
+            c11 += a2 * a2;
+            Vector rest = Vector(vertices_[i]) - Vector(p0) * (b0 + b1) - Vector(p3) * (b2 + b3);
+            x0 += a1 * rest;
+            x1 += a2 * rest;
+        }
+
+        // Fall back to a third of the chord for arms that come out
+        // degenerated, negative or longer than the polyline
+        double alpha1 = chord / 3, alpha2 = chord / 3;
+        double det = c00 * c11 - c01 * c01;
+        if (!DoubleUtil::IsZero(det))
+        {
+            double a1 = (x0 * c11 - x1 * c01) / det;
+            double a2 = (c00 * x1 - c01 * x0) / det;
+            double epsilon = 1.0e-6 * chord;
+            if (a1 > epsilon && a2 > epsilon && a1 < length && a2 < length)
+            {
+                alpha1 = a1;
+                alpha2 = a2;
+            }
+        }
+        control1 = p0 + t1 * alpha1;
+        control2 = p3 + t2 * alpha2;
+
+        double maxError = 0;
+        for (int i = first; i <= last; i++)
+        {
+            double error = (BezierPoint(p0, control1, control2, p3, params_[i - first]) - vertices_[i]).LengthSquared();
+            if (!(error <= maxError))
+                maxError = error;
+        }
+
+        if (maxError <= toleranceSquared)
+        {
+            for (int i = first; i < last; i++)
+            {
+                double middle = (params_[i - first] + params_[i - first + 1]) / 2;
+                double error = DistanceSquaredToSegment(BezierPoint(p0, control1, control2, p3, middle), vertices_[i], vertices_[i + 1]);
+                if (!(error <= toleranceSquared))
+                    return false;
+            }
+            return true;
+        }
+
+        if (!(maxError <= 16 * toleranceSquared))
+            return false;
+
+        for (int i = first + 1; i < last; i++)
+        {
+            params_[i - first] = NearestParameter(p0, control1, control2, p3, vertices_[i], params_[i - first]);
+        }
+    }
+    return false;
+}
+
+INKCANVAS_END_NAMESPACE
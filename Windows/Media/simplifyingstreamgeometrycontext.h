@@ -0,0 +1,92 @@
+#ifndef WINDOWS_MEDIA_SIMPLIFYINGSTREAMGEOMETRYCONTEXT_H
+#define WINDOWS_MEDIA_SIMPLIFYINGSTREAMGEOMETRYCONTEXT_H
+
+#include "Windows/Media/streamgeometrycontext.h"
+
+// namespace System.Windows.Media
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// A StreamGeometryContext that simplifies the polylines of the figures it
+/// receives before passing them on to another context. Runs of LineTo and
+/// PolyLineTo are thinned to the vertices that deviate more than half the
+/// tolerance from a straight line (Douglas-Peucker), and stretches of the
+/// remaining vertices that a cubic bezier follows within the other half
+/// become one BezierTo. No point of the original polyline is farther than
+/// tolerance from the simplified one. Curves, arcs and figure starts are
+/// passed on unchanged.
+/// </summary>
+class SimplifyingStreamGeometryContext : public StreamGeometryContext
+{
+public:
+    /// <summary>
+    /// Passes the simplified figures on to target, which is not closed
+    /// </summary>
+    SimplifyingStreamGeometryContext(StreamGeometryContext & target, double tolerance);
+
+    /// <summary>
+    /// Passes on the polyline run still held back, call before using target
+    /// </summary>
+    void Flush();
+
+    // StreamGeometryContext interface
+public:
+    virtual void BeginFigure(const Point &startPoint, bool isFilled, bool isClosed) override;
+    virtual void LineTo(const Point &point, bool isStroked, bool isSmoothJoin) override;
+    virtual void QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin) override;
+    virtual void BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin) override;
+    virtual void SetClosedState(bool closed) override;
+    virtual void DisposeCore() override;
+
+private:
+    /// <summary>
+    /// Fewest line segments replaced by a bezier, which takes three points
+    /// </summary>
+    static constexpr int MinCurveSegments = 4;
+
+    /// <summary>
+    /// Most simplified vertices a single bezier is tried over
+    /// </summary>
+    static constexpr int MaxCurveSegments = 64;
+
+    /// <summary>
+    /// Newton steps on the point parameters before a fit is given up
+    /// </summary>
+    static constexpr int MaxReparameterizations = 3;
+
+    void AddToRun(Point const & point, bool isStroked, bool isSmoothJoin);
+
+    void StartRun(Point const & point);
+
+    /// <summary>
+    /// Marks the vertices of run_ [first, last] that stay
+    /// </summary>
+    void SimplifyLines(int first, int last);
+
+    /// <summary>
+    /// Fits a cubic bezier to vertices_ [first, last], true if no vertex,
+    /// nor the curve between them, is farther than half the tolerance
+    /// </summary>
+    bool FitCurve(int first, int last, Vector const & tangent1, Vector const & tangent2,
+                  Point & control1, Point & control2);
+
+private:
+    StreamGeometryContext & target_;
+    double tolerance_;
+    List<Point> run_;      // current point, then the held back line points
+    List<int> keep_;       // 1 for the vertices of run_ that stay
+    List<Point> vertices_; // those vertices
+    List<int> pending_;    // ranges SimplifyLines has still to look at
+    List<double> params_;  // curve parameters of vertices_, for FitCurve
+    List<Point> lines_;
+    bool isStroked_ = true;
+    bool isSmoothJoin_ = true;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_MEDIA_SIMPLIFYINGSTREAMGEOMETRYCONTEXT_H
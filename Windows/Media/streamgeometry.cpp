@@ -17,6 +17,12 @@
 #include "Landing/Macos/macosstreamgeometrycontext.h"
 #endif
 
+// No landing to build native paths, record into a PathBuffer
+#if !defined INKCANVAS_QT && !defined INKCANVAS_ANDROID && !defined INKCANVAS_IOS && !defined INKCANVAS_MACOS
+#define STREAM_GEOMETRY_PATH_BUFFER 1
+#include "Windows/Media/pathbufferstreamgeometrycontext.h"
+#endif
+
 INKCANVAS_BEGIN_NAMESPACE
 
 StreamGeometry::StreamGeometry()
@@ -56,6 +62,9 @@ StreamGeometryContext &StreamGeometry::Open()
 #endif
 #ifdef INKCANVAS_MACOS
     context_ = new MacosStreamGeometryContext(this);
+#endif
+#if STREAM_GEOMETRY_PATH_BUFFER
+    context_ = new PathBufferStreamGeometryContext(this);
 #endif
     return *context_;
 }
@@ -65,15 +74,40 @@ void StreamGeometry::Close(void * path)
     path_ = path;
 }
 
+PathBuffer const * StreamGeometry::GetPathBuffer()
+{
+#if STREAM_GEOMETRY_PATH_BUFFER
+    return reinterpret_cast<PathBuffer*>(path_);
+#else
+    return nullptr;
+#endif
+}
+
 Rect StreamGeometry::Bounds()
 {
 #ifdef INKCANVAS_QT
     return reinterpret_cast<QPainterPath*>(path_)->boundingRect();
+#elif STREAM_GEOMETRY_PATH_BUFFER
+    return path_ ? reinterpret_cast<PathBuffer*>(path_)->Bounds() : Rect();
 #else
     return Rect();
 #endif
 }
 
+size_t StreamGeometry::ByteSize()
+{
+    size_t size = sizeof(StreamGeometry);
+    if (path_ == nullptr)
+        return size;
+#ifdef INKCANVAS_QT
+    QPainterPath const * path = reinterpret_cast<QPainterPath*>(path_);
+    size += sizeof(QPainterPath) + static_cast<size_t>(path->elementCount()) * sizeof(QPainterPath::Element);
+#elif STREAM_GEOMETRY_PATH_BUFFER
+    size += reinterpret_cast<PathBuffer*>(path_)->ByteSize();
+#endif
+    return size;
+}
+
 #ifdef INKCANVAS_QT_DRAW
 void StreamGeometry::Draw(QPainter &painter)
 {
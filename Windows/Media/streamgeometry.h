@@ -24,6 +24,7 @@ enum FillRule
 
 
 class StreamGeometryContext;
+class PathBuffer;
 
 // namespace System.Windows.Media
 
@@ -42,8 +43,16 @@ public:
 
     void * path() { return path_; }
 
+    /// <summary>
+    /// The recorded figures, in builds without a landing (plain INKCANVAS_CORE)
+    /// where path() is a PathBuffer. Returns nullptr with native paths.
+    /// </summary>
+    PathBuffer const * GetPathBuffer();
+
     virtual Rect Bounds() override;
 
+    virtual size_t ByteSize() override;
+
 #ifdef INKCANVAS_QT_DRAW
     virtual void Draw(QPainter& painter) override;
 #endif
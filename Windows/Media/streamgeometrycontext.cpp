@@ -1,4 +1,5 @@
 #include "Windows/Media/streamgeometrycontext.h"
+#include "cmath.h"
 
 INKCANVAS_BEGIN_NAMESPACE
 
@@ -7,4 +8,75 @@ StreamGeometryContext::StreamGeometryContext()
 
 }
 
+// Endpoint to center parameterization, see SVG 1.1 Implementation Notes F.6.5
+void StreamGeometryContext::ArcToBezier(Point const & startPoint, Point const & point, Size const & size, double rotationAngle,
+                                        bool isLargeArc, SweepDirection sweepDirection, List<Point> & bezierPoints)
+{
+    if (startPoint == point)
+        return;
+    double rx = Math::Abs(size.Width()), ry = Math::Abs(size.Height());
+    if (rx == 0.0 || ry == 0.0)
+    {
+        bezierPoints.Add(startPoint);
+        bezierPoints.Add(point);
+        bezierPoints.Add(point);
+        return;
+    }
+    rotationAngle = rotationAngle * Math::PI / 180;
+    double cosr = Math::Cos(rotationAngle), sinr = Math::Sin(rotationAngle);
+    // start point in the coordinate space of the unrotated ellipse, centered at the chord middle
+    double dx = (startPoint.X() - point.X()) / 2, dy = (startPoint.Y() - point.Y()) / 2;
+    double x1 = cosr * dx + sinr * dy;
+    double y1 = -sinr * dx + cosr * dy;
+    // scale up radii that are too small to reach
+    double lambda = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry);
+    if (lambda > 1.0)
+    {
+        lambda = Math::Sqrt(lambda);
+        rx *= lambda;
+        ry *= lambda;
+    }
+    double num = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1;
+    double den = rx * rx * y1 * y1 + ry * ry * x1 * x1;
+    double coef = num > 0 ? Math::Sqrt(num / den) : 0;
+    if (isLargeArc == (sweepDirection == SweepDirection::Clockwise))
+        coef = -coef;
+    double cx1 = coef * rx * y1 / ry;
+    double cy1 = -coef * ry * x1 / rx;
+    double cx = cosr * cx1 - sinr * cy1 + (startPoint.X() + point.X()) / 2;
+    double cy = sinr * cx1 + cosr * cy1 + (startPoint.Y() + point.Y()) / 2;
+    double theta = atan2((y1 - cy1) / ry, (x1 - cx1) / rx);
+    double delta = atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx) - theta;
+    // Y axis is down, so clockwise means increasing angle
+    if (sweepDirection == SweepDirection::Clockwise)
+    {
+        if (delta < 0)
+            delta += 2 * Math::PI;
+    }
+    else
+    {
+        if (delta > 0)
+            delta -= 2 * Math::PI;
+    }
+    int segments = static_cast<int>(std::ceil(Math::Abs(delta) / (Math::PI / 2) - 0.001));
+    if (segments < 1)
+        segments = 1;
+    delta /= segments;
+    double t = 4.0 / 3.0 * Math::Tan(delta / 4);
+    auto map = [=](double x, double y) {
+        x *= rx; y *= ry;
+        return Point(cx + cosr * x - sinr * y, cy + sinr * x + cosr * y);
+    };
+    double c0 = Math::Cos(theta), s0 = Math::Sin(theta);
+    for (int i = 0; i < segments; ++i)
+    {
+        theta += delta;
+        double c1 = Math::Cos(theta), s1 = Math::Sin(theta);
+        bezierPoints.Add(map(c0 - t * s0, s0 + t * c0));
+        bezierPoints.Add(map(c1 + t * s1, s1 - t * c1));
+        bezierPoints.Add(i + 1 == segments ? point : map(c1, s1));
+        c0 = c1; s0 = s1;
+    }
+}
+
 INKCANVAS_END_NAMESPACE
@@ -2,6 +2,7 @@
 #define WINDOWS_MEDIA_STREAMGEOMETRYCONTEXT_H
 
 #include "geometry.h"
+#include "Windows/size.h"
 #include "Collections/Generic/list.h"
 
 // namespace System.Windows.Media
@@ -102,6 +103,16 @@ public:
     /// SetClosedState - Sets the current closed state of the figure.
     /// </summary>
     virtual void SetClosedState(bool closed) = 0;
+
+    /// <summary>
+    /// ArcToBezier - Converts an ArcTo starting at startPoint into cubic bezier
+    /// segments of at most 90 degrees, appending the two control points and the
+    /// end point of each segment to bezierPoints. A degenerated arc (zero radius)
+    /// becomes a single straight segment, coincident end points add nothing.
+    /// For contexts whose target can't take elliptical arcs natively.
+    /// </summary>
+    static void ArcToBezier(Point const & startPoint, Point const & point, Size const & size, double rotationAngle,
+                            bool isLargeArc, SweepDirection sweepDirection, List<Point> & bezierPoints);
 };
 
 INKCANVAS_END_NAMESPACE
@@ -0,0 +1,91 @@
+#include "Windows/Media/transformingstreamgeometrycontext.h"
+
+INKCANVAS_BEGIN_NAMESPACE
+
+TransformingStreamGeometryContext::TransformingStreamGeometryContext(StreamGeometryContext & target, Matrix const & transform)
+    : target_(target)
+    , transform_(transform)
+{
+}
+
+void TransformingStreamGeometryContext::BeginFigure(const Point &startPoint, bool isFilled, bool isClosed)
+{
+    target_.BeginFigure(transform_.Transform(startPoint), isFilled, isClosed);
+    lastPoint_ = startPoint;
+}
+
+void TransformingStreamGeometryContext::LineTo(const Point &point, bool isStroked, bool isSmoothJoin)
+{
+    target_.LineTo(transform_.Transform(point), isStroked, isSmoothJoin);
+    lastPoint_ = point;
+}
+
+void TransformingStreamGeometryContext::QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin)
+{
+    target_.QuadraticBezierTo(transform_.Transform(point1), transform_.Transform(point2), isStroked, isSmoothJoin);
+    lastPoint_ = point2;
+}
+
+void TransformingStreamGeometryContext::BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin)
+{
+    target_.BezierTo(transform_.Transform(point1), transform_.Transform(point2), transform_.Transform(point3),
+                     isStroked, isSmoothJoin);
+    lastPoint_ = point3;
+}
+
+void TransformingStreamGeometryContext::PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    if (points.Count() == 0)
+        return;
+    PassPoints(points);
+    target_.PolyLineTo(points_, isStroked, isSmoothJoin);
+}
+
+void TransformingStreamGeometryContext::PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    if (points.Count() == 0)
+        return;
+    PassPoints(points);
+    target_.PolyQuadraticBezierTo(points_, isStroked, isSmoothJoin);
+}
+
+void TransformingStreamGeometryContext::PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin)
+{
+    if (points.Count() == 0)
+        return;
+    PassPoints(points);
+    target_.PolyBezierTo(points_, isStroked, isSmoothJoin);
+}
+
+void TransformingStreamGeometryContext::ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin)
+{
+    // A transformed ellipse has other radii and rotation, its bezier
+    //  segments are simply transformed
+    List<Point> points;
+    ArcToBezier(lastPoint_, point, size, rotationAngle, isLargeArc, sweepDirection, points);
+    lastPoint_ = point;
+    if (points.Count() == 0)
+        return;
+    PassPoints(points);
+    target_.PolyBezierTo(points_, isStroked, isSmoothJoin);
+}
+
+void TransformingStreamGeometryContext::SetClosedState(bool closed)
+{
+    target_.SetClosedState(closed);
+}
+
+void TransformingStreamGeometryContext::DisposeCore()
+{
+}
+
+void TransformingStreamGeometryContext::PassPoints(List<Point> const & points)
+{
+    points_.Clear();
+    points_.reserve(points.Count());
+    for (Point const & point : points)
+        points_.Add(transform_.Transform(point));
+    lastPoint_ = points[points.Count() - 1];
+}
+
+INKCANVAS_END_NAMESPACE
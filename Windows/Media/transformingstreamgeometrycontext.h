@@ -0,0 +1,48 @@
+#ifndef WINDOWS_MEDIA_TRANSFORMINGSTREAMGEOMETRYCONTEXT_H
+#define WINDOWS_MEDIA_TRANSFORMINGSTREAMGEOMETRYCONTEXT_H
+
+#include "Windows/Media/streamgeometrycontext.h"
+#include "Windows/Media/matrix.h"
+
+// namespace System.Windows.Media
+INKCANVAS_BEGIN_NAMESPACE
+
+/// <summary>
+/// A StreamGeometryContext that passes the figures it receives on to another
+/// context with all points transformed. Arcs are passed on as the bezier
+/// segments of ArcToBezier, which an affine transform maps exactly.
+/// </summary>
+class TransformingStreamGeometryContext : public StreamGeometryContext
+{
+public:
+    /// <summary>
+    /// Passes the transformed figures on to target, which is not closed
+    /// </summary>
+    TransformingStreamGeometryContext(StreamGeometryContext & target, Matrix const & transform);
+
+    // StreamGeometryContext interface
+public:
+    virtual void BeginFigure(const Point &startPoint, bool isFilled, bool isClosed) override;
+    virtual void LineTo(const Point &point, bool isStroked, bool isSmoothJoin) override;
+    virtual void QuadraticBezierTo(const Point &point1, const Point &point2, bool isStroked, bool isSmoothJoin) override;
+    virtual void BezierTo(const Point &point1, const Point &point2, const Point &point3, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyLineTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyQuadraticBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void PolyBezierTo(const List<Point> &points, bool isStroked, bool isSmoothJoin) override;
+    virtual void ArcTo(const Point &point, const Size &size, double rotationAngle, bool isLargeArc, SweepDirection sweepDirection, bool isStroked, bool isSmoothJoin) override;
+    virtual void SetClosedState(bool closed) override;
+    virtual void DisposeCore() override;
+
+private:
+    void PassPoints(List<Point> const & points);
+
+private:
+    StreamGeometryContext & target_;
+    Matrix transform_;
+    Point lastPoint_;      // untransformed, where arcs start
+    List<Point> points_;
+};
+
+INKCANVAS_END_NAMESPACE
+
+#endif // WINDOWS_MEDIA_TRANSFORMINGSTREAMGEOMETRYCONTEXT_H